@@ -26,164 +26,185 @@
 #include "core/ma_api.h"
 #include "core/minmax.h"
 #include "core/queue_api.h"
+#include "core/undef_api.h"
 
 #include "extended/assembly_stats_calculator.h"
 
 #include "gt_scaffolder_graph.h"
+#include "gt_scaffolder_bidirected.h"
+#include "gt_scaffolder_linereader.h"
 
 /* increment size for realloc of walk */
 #define INCREMENT_SIZE 32
 
 /* Check if vertex already has been filtered out of the graph */
 static bool
-vertex_is_marked(const GtScaffolderGraphVertex *vertex) {
-  gt_assert(vertex != NULL);
+vertex_is_marked(const GtScaffolderGraph *graph, GtUword vertex) {
+  gt_assert(vertex < graph->nof_vertices);
 
-  if (vertex->state == GIS_POLYMORPHIC || vertex->state == GIS_REPEAT
-     || vertex->state == GIS_CYCLIC)
-    return true;
-  else
-    return false;
+  return (GIS_MASK(graph->vertex_states[vertex]) & GIS_VERTEX_MARKED) != 0;
 }
 
 /* Check if edge already has been filtered out of the graph */
-static bool edge_is_marked(const GtScaffolderGraphEdge *edge) {
-  gt_assert(edge != NULL);
+static bool edge_is_marked(const GtScaffolderGraph *graph, GtUword edge) {
+  gt_assert(edge < graph->max_nof_edges);
 
-  if (edge->state == GIS_INCONSISTENT || edge->state == GIS_POLYMORPHIC
-     || edge->state == GIS_CYCLIC || edge->state == GIS_REPEAT)
-    return true;
-  else
-    return false;
+  return (GIS_MASK(graph->edge_states[edge]) & GIS_EDGE_MARKED) != 0;
 }
 
 /* Marks edge and its twin as GIS_STATE */
-static void mark_edge(GtScaffolderGraphEdge *edge, GraphItemState state) {
-  GtUword eid;
-
-  gt_assert(edge != NULL);
+static void mark_edge(GtScaffolderGraph *graph,
+                      GtUword edge,
+                      GraphItemState state) {
+  GtUword twin;
 
   /* mark edge as state*/
-  edge->state = state;
-  /* search twin-edge and mark twin-edge as state */
-  for (eid = 0; eid < edge->end->nof_edges; eid++) {
-    if (edge->end->edges[eid]->end == edge->start)
-      edge->end->edges[eid]->state = state;
-  }
+  gt_scaffolder_graph_set_edge_state(graph, edge, state);
+  /* mark twin-edge as state */
+  twin = gt_scaffolder_graph_edge_twin(graph, edge);
+  if (twin != GT_UNDEF_UWORD)
+    gt_scaffolder_graph_set_edge_state(graph, twin, state);
 }
 
 /* Marks vertex and all its edges and twins as GIS_STATE */
-static void mark_vertex(GtScaffolderGraphVertex *vertex, GraphItemState state) {
-  GtUword eid;
+static void mark_vertex(GtScaffolderGraph *graph,
+                        GtUword vertex,
+                        GraphItemState state) {
+  GtUword eid, first;
 
-  gt_assert(vertex != NULL);
+  gt_assert(vertex < graph->nof_vertices);
 
   /* mark vertex as state */
-  vertex->state = state;
+  gt_scaffolder_graph_set_vertex_state(graph, vertex, state);
 
   /* mark all edges and their twins as state */
-  for (eid = 0; eid < vertex->nof_edges; eid++)
-    mark_edge(vertex->edges[eid], state);
+  first = gt_scaffolder_graph_first_edge(graph, vertex);
+  for (eid = first;
+       eid < first + gt_scaffolder_graph_degree(graph, vertex); eid++)
+    mark_edge(graph, eid, state);
 }
 
-/* load a and copy number of every contig and mark repeated contigs */
-int gt_scaffolder_graph_mark_repeats(const char *filename,
-                                     GtScaffolderGraph *graph,
-                                     float copy_num_cutoff,
-                                     float astat_cutoff,
-                                     GtError *err)
+/* load a-statistics and copy number of every contig from file <filename>
+   into the vertices of <*graph> */
+int gt_scaffolder_graph_load_astat(const char *filename,
+                                   GtScaffolderGraph *graph,
+                                   GtError *err)
 {
-  const GtUword BUFSIZE_2 = 1024;
-  FILE *file;
-  char line[BUFSIZE_2+1], ctg_header[BUFSIZE_2+1];
+  GtScaffolderLineReader *reader;
+  char *line, *ctg_header;
+  GtUword line_len, header_len;
   GtWord num1, num2, num3;
   float astat, copy_num;
   bool valid_contig;
   int had_err;
-  GtStr *gt_str_field;
-  GtScaffolderGraphVertex *ctg;
+  GtUword ctg;
 
   had_err = 0;
 
-  if (strlen(filename) != 0) {
-    gt_str_field = gt_str_new();
-    file = fopen(filename, "rb");
-    if (file == NULL) {
-      had_err = -1;
-      gt_error_set(err, "can not read A-statistic file %s", filename);
-    }
-    if (had_err != -1)
-    {
-      /* iterate over each line of file until eof (contig record) */
-      while (fgets(line, BUFSIZE_2, file) != NULL) {
-
-        /* remove '\n' from end of line */
-        line[strlen(line)-1] = '\0';
-
-        num1 = 0;
-        num2 = 0;
-        num3 = 0;
-        copy_num = 0.0;
-        astat = 0.0;
-
-        /*parse record consisting of ctg_header, a-statistics and copy number*/
-        if (sscanf(line,"%s\t" GT_WD "\t" GT_WD "\t" GT_WD "\t%f\t%f",
-          ctg_header, &num1, &num2, &num3, &copy_num, &astat) == 6)
-        {
-          /* get vertex id corresponding to root contig header */
-          gt_str_set(gt_str_field, ctg_header);
-          /* gt_scaffolder_graph_get_vertex_id in if Statement schieben */
-          valid_contig = gt_scaffolder_graph_get_vertex(graph, &ctg,
-                     gt_str_field);
-
-          if (valid_contig) {
-            ctg->astat = astat;
-            ctg->copy_num = copy_num;
-          }
-        }
-        else {
-          had_err = -1;
-          gt_error_set(err, "Invalid record in A-statistic file %s", filename);
-          break;
+  reader = gt_scaffolder_line_reader_new(filename);
+  if (reader == NULL) {
+    had_err = -1;
+    gt_error_set(err, "can not read A-statistic file %s", filename);
+  }
+  if (had_err != -1)
+  {
+    /* iterate over each line of file until eof (contig record), lines of
+       any length are handed out in place */
+    while (gt_scaffolder_line_reader_next(reader, &line, &line_len)) {
+
+      num1 = 0;
+      num2 = 0;
+      num3 = 0;
+      copy_num = 0.0;
+      astat = 0.0;
+
+      /* the contig header is not copied but looked up in place */
+      ctg_header = line + strspn(line, " \t\n\v\f\r");
+      header_len = strcspn(ctg_header, " \t\n\v\f\r");
+
+      /*parse record consisting of ctg_header, a-statistics and copy number*/
+      if (header_len > 0 &&
+          sscanf(ctg_header + header_len, "\t" GT_WD "\t" GT_WD "\t" GT_WD
+                 "\t%f\t%f", &num1, &num2, &num3, &copy_num, &astat) == 5)
+      {
+        /* get vertex id corresponding to root contig header */
+        valid_contig = gt_scaffolder_graph_get_vertex(graph, &ctg,
+                   ctg_header, header_len);
+
+        if (valid_contig) {
+          graph->vertices[ctg].astat = astat;
+          graph->vertices[ctg].copy_num = copy_num;
         }
       }
-      fclose(file);
+      else {
+        had_err = -1;
+        gt_error_set(err, "Invalid record in A-statistic file %s", filename);
+        break;
+      }
     }
-    gt_str_delete(gt_str_field);
+    gt_scaffolder_line_reader_delete(reader);
   }
 
-  if (had_err != -1)
-  {
-    GtScaffolderGraphVertex *vertex;
+  return had_err;
+}
 
-    /*iterate over all vertices and mark them as repeats if cutoff is exceeded*/
-    for (vertex = graph->vertices;
-      vertex < (graph->vertices + graph->nof_vertices); vertex++)
-    {
-       if (vertex->astat <= astat_cutoff ||
-          (strlen(filename) != 0 && vertex->copy_num < copy_num_cutoff))
-        mark_vertex(vertex, GIS_REPEAT);
-    }
+/* mark contigs with a-statistics of at most <astat_cutoff> or copy number
+   below <copy_num_cutoff> as repeats, a <copy_num_cutoff> of 0 ignores the
+   copy number */
+void gt_scaffolder_graph_mark_repeat_vertices(GtScaffolderGraph *graph,
+                                              float copy_num_cutoff,
+                                              float astat_cutoff)
+{
+  GtUword vid;
+
+  /*iterate over all vertices and mark them as repeats if cutoff is exceeded*/
+  for (vid = 0; vid < graph->nof_vertices; vid++)
+  {
+     if (graph->vertices[vid].astat <= astat_cutoff ||
+        graph->vertices[vid].copy_num < copy_num_cutoff)
+      mark_vertex(graph, vid, GIS_REPEAT);
   }
+}
+
+/* load a and copy number of every contig and mark repeated contigs */
+int gt_scaffolder_graph_mark_repeats(const char *filename,
+                                     GtScaffolderGraph *graph,
+                                     float copy_num_cutoff,
+                                     float astat_cutoff,
+                                     GtError *err)
+{
+  int had_err = 0;
+
+  /* without file only the annotated a-statistics are used */
+  if (strlen(filename) != 0)
+    had_err = gt_scaffolder_graph_load_astat(filename, graph, err);
+  else
+    copy_num_cutoff = 0.0;
+
+  if (had_err != -1)
+    gt_scaffolder_graph_mark_repeat_vertices(graph, copy_num_cutoff,
+                                             astat_cutoff);
 
   return had_err;
 }
 
-/* check if unique order of edges <*edge1>, <*edge2> with probability
+/* check if unique order of edges <edge1>, <edge2> with probability
    <cutoff> exists */
 static bool
-gt_scaffolder_graph_ambiguousorder(const GtScaffolderGraphEdge *edge1,
-                                   const GtScaffolderGraphEdge *edge2,
+gt_scaffolder_graph_ambiguousorder(const GtScaffolderGraph *graph,
+                                   GtUword edge1,
+                                   GtUword edge2,
                                    float cutoff)
 {
-  float expval, variance, interval, prob12, prob21, p_wrong;
+  float expval, variance, interval, prob12, prob21, p_wrong, std_dev1,
+        std_dev2;
 
-  gt_assert(edge1 != NULL);
-  gt_assert(edge2 != NULL);
+  gt_assert(graph != NULL);
 
-  expval = edge1->dist - edge2->dist;
-  variance = 2 * ((edge1->std_dev * edge1->std_dev) +
-                  (edge2->std_dev * edge2->std_dev));
+  std_dev1 = graph->edge_info[edge1].std_dev;
+  std_dev2 = graph->edge_info[edge2].std_dev;
+  expval = (GtWord) graph->edges[edge1].dist - graph->edges[edge2].dist;
+  variance = 2 * ((std_dev1 * std_dev1) + (std_dev2 * std_dev2));
   interval = (0 - expval) / sqrt(variance);
   prob12 = 0.5 * (1 + erf(interval) );
   prob21 = 1.0 - prob12;
@@ -195,7 +216,8 @@ gt_scaffolder_graph_ambiguousorder(const GtScaffolderGraphEdge *edge1,
 /* calculate overlap of edge1->end and edge2->end with respect to the
    distance to edge1->start and edge2->start, which must be equal. */
 static GtWord
-gt_scaffolder_calculate_overlap(const GtScaffolderGraphEdge *edge1,
+gt_scaffolder_calculate_overlap(const GtScaffolderGraph *graph,
+                                const GtScaffolderGraphEdge *edge1,
                                 const GtScaffolderGraphEdge *edge2)
 {
   GtWord overlap = 0;
@@ -206,8 +228,8 @@ gt_scaffolder_calculate_overlap(const GtScaffolderGraphEdge *edge1,
 
   start1 = edge1->dist;
   start2 = edge2->dist;
-  end1 = edge1->dist + edge1->end->seq_len - 1;
-  end2 = edge2->dist + edge2->end->seq_len - 1;
+  end1 = edge1->dist + graph->vertices[edge1->end].seq_len - 1;
+  end2 = edge2->dist + graph->vertices[edge2->end].seq_len - 1;
 
   if (start2 <= end1 &&
       start1 <= end2)
@@ -221,40 +243,45 @@ gt_scaffolder_calculate_overlap(const GtScaffolderGraphEdge *edge1,
 
 /* checks if edge1->end and edge2->end are polymorphic */
 static void
-gt_scaffolder_graph_check_mark_polymorphic(const GtScaffolderGraphEdge *edge1,
-                                           const GtScaffolderGraphEdge *edge2,
+gt_scaffolder_graph_check_mark_polymorphic(GtScaffolderGraph *graph,
+                                           GtUword edge1,
+                                           GtUword edge2,
                                            float pcutoff,
                                            float cncutoff)
 {
-  GtScaffolderGraphVertex *poly_vertex;
+  GtUword end1, end2, poly_vertex;
 
-  gt_assert(edge1 != NULL);
-  gt_assert(edge2 != NULL);
+  gt_assert(graph != NULL);
 
-  if (gt_scaffolder_graph_ambiguousorder(edge1, edge2, pcutoff) &&
-      (edge1->end->copy_num + edge2->end->copy_num) < cncutoff) {
+  end1 = graph->edges[edge1].end;
+  end2 = graph->edges[edge2].end;
+  if (gt_scaffolder_graph_ambiguousorder(graph, edge1, edge2, pcutoff) &&
+      (graph->vertices[end1].copy_num + graph->vertices[end2].copy_num)
+      < cncutoff) {
     /* mark vertex with lower copy number as polymorphic */
-    if (edge1->end->copy_num < edge2->end->copy_num)
-      poly_vertex = edge1->end;
+    if (graph->vertices[end1].copy_num < graph->vertices[end2].copy_num)
+      poly_vertex = end1;
     else
-      poly_vertex = edge2->end;
+      poly_vertex = end2;
     /* mark all edges of the polymorphic vertex as polymorphic */
-    if (!vertex_is_marked(poly_vertex)) {
-      mark_vertex(poly_vertex, GIS_POLYMORPHIC);
+    if (!vertex_is_marked(graph, poly_vertex)) {
+      mark_vertex(graph, poly_vertex, GIS_POLYMORPHIC);
     }
   }
 }
 
 /* marks all edges of vertex in direction <sense> as inconsistent */
-static void mark_edges_in_twin_dir(GtScaffolderGraphVertex *vertex,
+static void mark_edges_in_twin_dir(GtScaffolderGraph *graph,
+                                   GtUword vertex,
                                    bool sense)
 {
-  GtUword eid;
+  GtUword eid, first;
 
-  for (eid = 0; eid < vertex->nof_edges; eid++) {
-    if (vertex->edges[eid]->sense == sense)
-      vertex->edges[eid]->state = GIS_INCONSISTENT;
-  }
+  first = gt_scaffolder_graph_first_edge_in_dir(graph, vertex, sense);
+  for (eid = first;
+       eid < first + gt_scaffolder_graph_degree_in_dir(graph, vertex, sense);
+       eid++)
+    gt_scaffolder_graph_set_edge_state(graph, eid, GIS_INCONSISTENT);
 }
 
 /* mark polymorphic edges/vertices and inconsistent edges in scaffold graph */
@@ -263,78 +290,87 @@ void gt_scaffolder_graph_filter(GtScaffolderGraph *graph,
                                 float cncutoff,
                                 GtWord ocutoff)
 {
-  GtScaffolderGraphVertex *vertex;
   GtScaffolderGraphEdge *edge1, *edge2;
-  GtUword eid1, eid2;
+  GtUword vid, eid1, eid2, first, last;
   GtWord sense_maxoverlap, antisense_maxoverlap, overlap;
-  bool twin_dir;
+  bool sense, sense1, twin_dir;
 
   gt_assert(graph != NULL);
 
   /* iterate over all vertices */
-  for (vertex = graph->vertices;
-       vertex < (graph->vertices + graph->nof_vertices); vertex++) {
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
 
     /* ignore repeat vertices */
-    if (vertex_is_marked(vertex))
+    if (vertex_is_marked(graph, vid))
       continue;
 
-    /* iterate over all pairs of edges */
-    for (eid1 = 0; eid1 < vertex->nof_edges; eid1++) {
-      for (eid2 = eid1 + 1; eid2 < vertex->nof_edges; eid2++) {
-        edge1 = vertex->edges[eid1];
-        edge2 = vertex->edges[eid2];
-
-        if (edge1->sense == edge2->sense) {
+    /* iterate over all pairs of edges in the same direction */
+    for (sense = false; ; sense = true) {
+      first = gt_scaffolder_graph_first_edge_in_dir(graph, vid, sense);
+      last = first + gt_scaffolder_graph_degree_in_dir(graph, vid, sense);
+      for (eid1 = first; eid1 < last; eid1++) {
+        for (eid2 = eid1 + 1; eid2 < last; eid2++) {
           /* check if edge1->end and edge2->end are polymorphic */
-          gt_scaffolder_graph_check_mark_polymorphic(edge1, edge2,
+          gt_scaffolder_graph_check_mark_polymorphic(graph, eid1, eid2,
                                                      pcutoff, cncutoff);
           /* SD: Nur das erste Paar polymoprh markieren? */
         }
       }
+      if (sense)
+        break;
     }
 
     /* no need to check inconsistent edges for polymorphic vertices */
-    if (vertex_is_marked(vertex))
+    if (vertex_is_marked(graph, vid))
       continue;
 
     sense_maxoverlap = 0;
     antisense_maxoverlap = 0;
-    /* iterate over all pairs of edges, that are not polymorphic */
-    for (eid1 = 0; eid1 < vertex->nof_edges; eid1++) {
-      for (eid2 = eid1 + 1; eid2 < vertex->nof_edges; eid2++) {
-        edge1 = vertex->edges[eid1];
-        edge2 = vertex->edges[eid2];
-        if ((edge1->sense == edge2->sense) &&
-            (!edge_is_marked(edge1) && !edge_is_marked(edge2))) {
-          overlap = gt_scaffolder_calculate_overlap(edge1, edge2);
+    /* iterate over all pairs of edges in the same direction, that are not
+       polymorphic */
+    for (sense = false; ; sense = true) {
+      first = gt_scaffolder_graph_first_edge_in_dir(graph, vid, sense);
+      last = first + gt_scaffolder_graph_degree_in_dir(graph, vid, sense);
+      for (eid1 = first; eid1 < last; eid1++) {
+        for (eid2 = eid1 + 1; eid2 < last; eid2++) {
+          if (edge_is_marked(graph, eid1) || edge_is_marked(graph, eid2))
+            continue;
+          edge1 = graph->edges + eid1;
+          edge2 = graph->edges + eid2;
+          overlap = gt_scaffolder_calculate_overlap(graph, edge1, edge2);
 
           /* differentiate between maximal overlap of sense edge
              pairs and antisense edge pairs */
-          if (edge1->sense && overlap > sense_maxoverlap)
+          if (sense && overlap > sense_maxoverlap)
             sense_maxoverlap = overlap;
-          if (!edge1->sense && overlap > antisense_maxoverlap)
+          if (!sense && overlap > antisense_maxoverlap)
             antisense_maxoverlap = overlap;
         }
       }
+      if (sense)
+        break;
     }
 
     /* check if maxoverlap is larger than ocutoff and mark edges
        as inconsistent */
     if (sense_maxoverlap > ocutoff || antisense_maxoverlap > ocutoff) {
 
-      for (eid1 = 0; eid1 < vertex->nof_edges; eid1++) {
-        if (sense_maxoverlap > ocutoff && vertex->edges[eid1]->sense) {
-          vertex->edges[eid1]->state = GIS_INCONSISTENT;
+      first = gt_scaffolder_graph_first_edge(graph, vid);
+      last = first + gt_scaffolder_graph_degree(graph, vid);
+      for (eid1 = first; eid1 < last; eid1++) {
+        edge1 = graph->edges + eid1;
+        sense1 = gt_scaffolder_graph_edge_sense(edge1);
+        if (sense_maxoverlap > ocutoff && sense1) {
+          gt_scaffolder_graph_set_edge_state(graph, eid1, GIS_INCONSISTENT);
           /* adapted from SGA, is it necessary to mark all edges
              in twin dir? */
-          twin_dir = !vertex->edges[eid1]->same;
-          mark_edges_in_twin_dir(vertex->edges[eid1]->end, twin_dir);
+          twin_dir = !gt_scaffolder_graph_edge_same(edge1);
+          mark_edges_in_twin_dir(graph, edge1->end, twin_dir);
         }
-        if (antisense_maxoverlap > ocutoff && !vertex->edges[eid1]->sense) {
-          vertex->edges[eid1]->state = GIS_INCONSISTENT;
-          twin_dir = vertex->edges[eid1]->same;
-          mark_edges_in_twin_dir(vertex->edges[eid1]->end, twin_dir);
+        if (antisense_maxoverlap > ocutoff && !sense1) {
+          gt_scaffolder_graph_set_edge_state(graph, eid1, GIS_INCONSISTENT);
+          twin_dir = gt_scaffolder_graph_edge_same(edge1);
+          mark_edges_in_twin_dir(graph, edge1->end, twin_dir);
         }
       }
 
@@ -343,87 +379,75 @@ void gt_scaffolder_graph_filter(GtScaffolderGraph *graph,
 }
 
 /* check if vertex holds just sense or antisense edges */
-bool gt_scaffolder_graph_isterminal(const GtScaffolderGraphVertex *vertex)
+bool gt_scaffolder_graph_isterminal(const GtScaffolderGraph *graph,
+                                    GtUword vertex)
 {
-  bool dir;
-  bool set_dir = false;
-  GtUword eid;
-
-  gt_assert(vertex != NULL);
-
-  if (vertex->nof_edges == 0)
-    return true;
+  gt_assert(vertex < graph->nof_vertices);
 
-  for (eid = 0; eid < vertex->nof_edges; eid++) {
-    if (set_dir) {
-      if (vertex->edges[eid]->sense != dir &&
-          !edge_is_marked(vertex->edges[eid]))
-        return false;
-    }
-    else {
-      if (!edge_is_marked(vertex->edges[eid])) {
-        dir = vertex->edges[eid]->sense;
-        set_dir = true;
-      }
-    }
-
-  }
-
-  return true;
+  /* only unmarked edges count */
+  return gt_scaffolder_graph_active_degree(graph, vertex, true) == 0 ||
+         gt_scaffolder_graph_active_degree(graph, vertex, false) == 0;
 }
 
 /* traverse the graph and calculate all connected components. all
    terminal vertices for each connected component are stored in an
    GtArray. all GtArray for the terminial vertices are stored in
-   ccs. */
-void gt_scaffolder_calc_cc_and_terminals(const GtScaffolderGraph *graph,
+   ccs. <*bg> has to be converted from <*graph>. */
+void gt_scaffolder_calc_cc_and_terminals(GtScaffolderGraph *graph,
+                                         const GtScaffolderBidirectedGraph *bg,
                                          GtArray *ccs)
 {
   GtArray *terminal_vertices = NULL;
-  GtQueue *vqueue = NULL;
-  GtScaffolderGraphVertex *vertex, *currentvertex, *nextvertex;
-  GtUword eid;
+  GtUword *vqueue, qhead, qtail;
+  GtUword vid, currentvertex, nextvertex, lid, first, last;
 
   gt_assert(graph != NULL);
   gt_assert(ccs != NULL);
 
-  for (vertex = graph->vertices; vertex <
-      (graph->vertices + graph->nof_vertices); vertex++) {
-    if (!vertex_is_marked(vertex))
-      vertex->state = GIS_UNVISITED;
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    if (!vertex_is_marked(graph, vid))
+      gt_scaffolder_graph_set_vertex_state(graph, vid, GIS_UNVISITED);
   }
 
-  vqueue = gt_queue_new();
+  /* every vertex enters the queue at most once */
+  vqueue = gt_malloc(sizeof (*vqueue) * graph->nof_vertices);
 
-  for (vertex = graph->vertices; vertex <
-      (graph->vertices + graph->nof_vertices); vertex++) {
-    if (vertex_is_marked(vertex) ||
-        vertex->state == GIS_VISITED)
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    if (vertex_is_marked(graph, vid) ||
+        graph->vertex_states[vid] == GIS_VISITED)
       continue;
 
-    vertex->state = GIS_PROCESSED;
-    gt_queue_add(vqueue, vertex);
+    gt_scaffolder_graph_set_vertex_state(graph, vid, GIS_PROCESSED);
+    qhead = qtail = 0;
+    vqueue[qtail++] = vid;
     /* create a new gt_array-object to store the terminal vertices for
        the next cc */
-    terminal_vertices = gt_array_new(sizeof (vertex));
+    terminal_vertices = gt_array_new(sizeof (vid));
 
-    while (gt_queue_size(vqueue) != 0) {
-      currentvertex = (GtScaffolderGraphVertex*)gt_queue_get(vqueue);
+    while (qhead != qtail) {
+      currentvertex = vqueue[qhead++];
 
       /* store all terminal vertices */
-      if (gt_scaffolder_graph_isterminal(currentvertex))
+      if (gt_scaffolder_graph_isterminal(graph, currentvertex))
         gt_array_add(terminal_vertices, currentvertex);
 
-      currentvertex->state = GIS_VISITED;
-      for (eid = 0; eid < currentvertex->nof_edges; eid++) {
-        if (!edge_is_marked(currentvertex->edges[eid])) {
-          nextvertex = currentvertex->edges[eid]->end;
+      gt_scaffolder_graph_set_vertex_state(graph, currentvertex, GIS_VISITED);
+      /* the links of both sides of a contig are consecutive */
+      first = gt_scaffolder_bidirected_first_link(bg,
+                gt_scaffolder_bidirected_side(currentvertex, false));
+      last = gt_scaffolder_bidirected_first_link(bg,
+               gt_scaffolder_bidirected_side(currentvertex, true) + 1);
+      for (lid = first; lid < last; lid++) {
+        if (!edge_is_marked(graph, gt_scaffolder_bidirected_link_edge(bg,
+                                                                      lid))) {
+          nextvertex = gt_scaffolder_bidirected_vertex(bg->targets[lid]);
           /* just take vertices, that are consistent */
-          if (vertex_is_marked(nextvertex))
+          if (vertex_is_marked(graph, nextvertex))
             continue;
-          if (nextvertex->state == GIS_UNVISITED) {
-            nextvertex->state = GIS_PROCESSED;
-            gt_queue_add(vqueue, nextvertex);
+          if (graph->vertex_states[nextvertex] == GIS_UNVISITED) {
+            gt_scaffolder_graph_set_vertex_state(graph, nextvertex,
+                                                 GIS_PROCESSED);
+            vqueue[qtail++] = nextvertex;
           }
         }
       }
@@ -432,88 +456,80 @@ void gt_scaffolder_calc_cc_and_terminals(const GtScaffolderGraph *graph,
     gt_array_add(ccs, terminal_vertices);
   }
 
-  gt_queue_delete(vqueue);
+  gt_free(vqueue);
 }
 
-/* checks, if e1->start = e2->end and e1->end = e2->start */
-static bool
-is_twin(const GtScaffolderGraphEdge *e1, const GtScaffolderGraphEdge *e2) {
-  if (e1->start == e2->end &&
-      e1->end == e2->start)
-    return true;
-  return false;
-}
-
-/* DFS to detect Cycles given a starting vertex */
-GtScaffolderGraphEdge *
-gt_scaffolder_detect_cycle_recursive(GtScaffolderGraphVertex *v,
-                                     GtScaffolderGraphVertex *p,
-                                     bool dir,
+/* DFS to detect Cycles given a starting side of a vertex of <*graph> in
+   <*bg>, <p> is the vertex the side was reached from. Returns id of the back
+   edge or GT_UNDEF_UWORD */
+GtUword
+gt_scaffolder_detect_cycle_recursive(GtScaffolderGraph *graph,
+                                     const GtScaffolderBidirectedGraph *bg,
+                                     GtUword side,
+                                     GtUword p,
                                      GtArray *visited)
 {
-  GtUword eid;
-  GtScaffolderGraphEdge *back;
-  bool next_dir;
+  GtUword v, lid, eid, first, last, back, end;
 
-  gt_assert(v != NULL);
+  gt_assert(side < bg->nof_sides);
 
+  v = gt_scaffolder_bidirected_vertex(side);
   gt_array_add(visited, v);
-  v->state = GIS_VISITED;
-
-  for (eid = 0; eid < v->nof_edges; eid++) {
-    back = v->edges[eid];
-    if (back->sense == dir &&
-        !edge_is_marked(back) &&
-        back->end != p) {
-
-      if (!vertex_is_marked(back->end)) {
-        if (back->end->state == GIS_VISITED)
-          return back;
-
-        if (back->end->state == GIS_UNVISITED) {
-          /* SGA: set cur_dir to !back->twin->dir */
-          if (back->same)
-            next_dir = back->sense ? true : false;
-          else
-            next_dir = back->sense ? false : true;
-
-          back = gt_scaffolder_detect_cycle_recursive(back->end, v, next_dir,
+  gt_scaffolder_graph_set_vertex_state(graph, v, GIS_VISITED);
+
+  first = gt_scaffolder_bidirected_first_link(bg, side);
+  last = first + gt_scaffolder_bidirected_degree(bg, side);
+  for (lid = first; lid < last; lid++) {
+    eid = gt_scaffolder_bidirected_link_edge(bg, lid);
+    end = gt_scaffolder_bidirected_vertex(bg->targets[lid]);
+    if (!edge_is_marked(graph, eid) && end != p) {
+
+      if (!vertex_is_marked(graph, end)) {
+        if (graph->vertex_states[end] == GIS_VISITED)
+          return eid;
+
+        if (graph->vertex_states[end] == GIS_UNVISITED) {
+          /* the link leads to the side to leave <end> through */
+          back = gt_scaffolder_detect_cycle_recursive(graph, bg,
+                                                      bg->targets[lid], v,
                                                       visited);
 
-          if (back != NULL)
+          if (back != GT_UNDEF_UWORD)
             return back;
         }
       }
     }
   }
 
-  v->state = GIS_PROCESSED;
-  return NULL;
+  gt_scaffolder_graph_set_vertex_state(graph, v, GIS_PROCESSED);
+  return GT_UNDEF_UWORD;
 }
 
-/*  remove cycles */
-void gt_scaffolder_removecycles(GtScaffolderGraph *graph) {
+/* remove cycles using the sides of <*bg>, which has to be converted from
+   <*graph> */
+static void gt_scaffolder_removecycles_sides(GtScaffolderGraph *graph,
+                                             const GtScaffolderBidirectedGraph
+                                             *bg)
+{
   bool found_cycle = true;
   GtUword i, j, k;
   GtArray *ccs, *terminal_vertices, *visited;
-  GtScaffolderGraphEdge *back_edge;
-  GtScaffolderGraphVertex *start, *v;
+  GtUword back_edge, start, v;
 
   gt_assert(graph != NULL);
 
   ccs = gt_array_new(sizeof (GtArray *));
-  visited = gt_array_new(sizeof (GtScaffolderGraphVertex *));
+  visited = gt_array_new(sizeof (GtUword));
 
   while (found_cycle) {
     found_cycle = false;
 
-    gt_scaffolder_calc_cc_and_terminals(graph, ccs);
+    gt_scaffolder_calc_cc_and_terminals(graph, bg, ccs);
 
     /* initialize all vertices as not visited */
-    for (v = graph->vertices; v < (graph->vertices + graph->nof_vertices);
-         v++) {
-      if (!vertex_is_marked(v))
-        v->state = GIS_UNVISITED;
+    for (v = 0; v < graph->nof_vertices; v++) {
+      if (!vertex_is_marked(graph, v))
+        gt_scaffolder_graph_set_vertex_state(graph, v, GIS_UNVISITED);
     }
 
     /* iterate over all ccs */
@@ -522,42 +538,40 @@ void gt_scaffolder_removecycles(GtScaffolderGraph *graph) {
 
       /* iterate over all terminal vertices of this cc */
       for (j = 0; j < gt_array_size(terminal_vertices); j++) {
-        start = *(GtScaffolderGraphVertex **)
-                gt_array_get(terminal_vertices, j);
+        start = *(GtUword *) gt_array_get(terminal_vertices, j);
         /* search for a cycle, if terminal vertex has edges */
-        if (start->nof_edges > 0) {
-          GtUword eid;
-          bool dir = true;
-          bool set_dir = false;
-
-          for (eid = 0; eid < start->nof_edges; eid++) {
-            if (!edge_is_marked(start->edges[eid])) {
-              dir = start->edges[eid]->sense;
-              set_dir = true;
-            }
-          }
-
-          if (!set_dir)
+        if (gt_scaffolder_graph_degree(graph, start) > 0) {
+          bool dir;
+
+          /* the unmarked edges of a terminal vertex share one direction */
+          if (gt_scaffolder_graph_active_degree(graph, start, true) > 0)
+            dir = true;
+          else if (gt_scaffolder_graph_active_degree(graph, start, false) > 0)
+            dir = false;
+          else
             continue;
 
-          if (vertex_is_marked(start))
+          if (vertex_is_marked(graph, start))
             continue;
 
-          back_edge = gt_scaffolder_detect_cycle_recursive(start, NULL,
-                                                           dir, visited);
+          back_edge = gt_scaffolder_detect_cycle_recursive(graph, bg,
+                        gt_scaffolder_bidirected_side(start, dir),
+                        GT_UNDEF_UWORD, visited);
 
           /* mark all visited vertices as unvisited for the next search */
           for (k = 0; k < gt_array_size(visited); k++) {
-            v = *(GtScaffolderGraphVertex **) gt_array_get(visited, k);
-            v->state = GIS_UNVISITED;
+            v = *(GtUword *) gt_array_get(visited, k);
+            gt_scaffolder_graph_set_vertex_state(graph, v, GIS_UNVISITED);
           }
 
           gt_array_reset(visited);
 
-          if (back_edge != NULL) {
+          if (back_edge != GT_UNDEF_UWORD) {
             found_cycle = true;
-            mark_vertex(back_edge->start, GIS_CYCLIC);
-            mark_vertex(back_edge->end, GIS_CYCLIC);
+            mark_vertex(graph,
+                        gt_scaffolder_graph_edge_start(graph, back_edge),
+                        GIS_CYCLIC);
+            mark_vertex(graph, graph->edges[back_edge].end, GIS_CYCLIC);
           }
         }
       }
@@ -577,6 +591,18 @@ void gt_scaffolder_removecycles(GtScaffolderGraph *graph) {
   gt_array_delete(visited);
 }
 
+/*  remove cycles */
+void gt_scaffolder_removecycles(GtScaffolderGraph *graph)
+{
+  GtScaffolderBidirectedGraph *bg;
+
+  gt_assert(graph != NULL);
+
+  bg = gt_scaffolder_bidirected_new(graph);
+  gt_scaffolder_removecycles_sides(graph, bg);
+  gt_scaffolder_bidirected_delete(bg);
+}
+
 /* create new walk */
 GtScaffolderGraphWalk *gt_scaffolder_walk_new(void)
 {
@@ -598,41 +624,47 @@ void gt_scaffolder_walk_delete(GtScaffolderGraphWalk *walk)
   gt_free(walk);
 }
 
-/* add edge <*edge> to walk <*walk> */
-void gt_scaffolder_walk_addegde(GtScaffolderGraphWalk *walk,
-                                GtScaffolderGraphEdge *edge)
+/* add edge <edge> of <*graph> to walk <*walk> */
+void gt_scaffolder_walk_addegde(const GtScaffolderGraph *graph,
+                                GtScaffolderGraphWalk *walk,
+                                GtUword edge)
 {
   gt_assert(walk != NULL);
-  gt_assert(edge != NULL);
+  gt_assert(edge < graph->max_nof_edges);
 
   if (walk->size == walk->nof_edges) {
     walk->size += INCREMENT_SIZE;
     walk->edges = gt_realloc(walk->edges, walk->size*sizeof (*walk->edges));
   }
   walk->edges[walk->nof_edges] = edge;
-  walk->total_contig_len += edge->end->seq_len;
+  walk->total_contig_len += graph->vertices[graph->edges[edge].end].seq_len;
   walk->nof_edges++;
 }
 
 /* creates all minimal walks with respect to edge->dist from start to
    every other terminal vertex in the current cc. the walk with the
-   greatest total contig length is returned */
+   greatest total contig length is returned. The search follows the links of
+   <*bg>, which has to be converted from <*graph>. */
 GtScaffolderGraphWalk
 *gt_scaffolder_create_walk(GtScaffolderGraph *graph,
-                           GtScaffolderGraphVertex *start)
+                           const GtScaffolderBidirectedGraph *bg,
+                           GtUword start)
 {
   GtQueue *wqueue;
   GtArray *terminal_vertices;
-  GtScaffolderGraphEdge *edge, *reverseedge, *nextedge, **edgemap;
-  GtScaffolderGraphVertex *endvertex, *currentvertex, *nextendvertex;
-  GtUword lengthbestwalk, lengthcwalk, eid, i;
+  const GtScaffolderGraphEdge *edge, *nextedge;
+  GtUword endvertex, currentvertex, nextendvertex, twin, *edgemap;
+  GtUword lengthbestwalk, lengthcwalk, lid, eid, side, first, last, i;
   GtScaffolderGraphWalk *bestwalk, *currentwalk;
   float distance, *distancemap;
   GtScaffolderGraphNode *node;
-  bool dir;
 
   gt_assert(graph != NULL);
-  gt_assert(start != NULL);
+  gt_assert(start < graph->nof_vertices);
+
+  /* check if node has edges */
+  if (gt_scaffolder_graph_degree(graph, start) == 0)
+    return NULL;
 
   lengthbestwalk = 0;
 
@@ -651,27 +683,24 @@ GtScaffolderGraphWalk
 
   edgemap = gt_malloc(sizeof (*edgemap)*graph->nof_vertices);
 
-  /* check if node has edges */
-  if (start->nof_edges == 0) {
-    gt_free(edgemap);
-    gt_free(distancemap);
-    return NULL;
-  }
-
-  for (eid = 0; eid < start->nof_edges; eid++) {
-    edge = start->edges[eid];
-    if (!edge_is_marked(edge) &&
-        !vertex_is_marked(edge->end))
+  /* the links of both sides of a contig are consecutive */
+  first = gt_scaffolder_bidirected_first_link(bg,
+            gt_scaffolder_bidirected_side(start, false));
+  last = gt_scaffolder_bidirected_first_link(bg,
+           gt_scaffolder_bidirected_side(start, true) + 1);
+  for (lid = first; lid < last; lid++) {
+    eid = gt_scaffolder_bidirected_link_edge(bg, lid);
+    edge = graph->edges + eid;
+    if (!edge_is_marked(graph, eid) &&
+        !vertex_is_marked(graph, edge->end))
     {
       GtScaffolderGraphNode *initial_node = gt_malloc(sizeof (*initial_node));
       endvertex = edge->end;
 
-      GtUword endvertex_index = gt_scaffolder_graph_get_vertex_id(graph,
-                                                                  endvertex);
-      distancemap[endvertex_index] = edge->dist;
-      edgemap[endvertex_index] = edge;
+      distancemap[endvertex] = edge->dist;
+      edgemap[endvertex] = eid;
 
-      initial_node->edge = edge;
+      initial_node->edge = lid;
       initial_node->dist = edge->dist;
 
       gt_queue_add(wqueue, initial_node);
@@ -680,48 +709,44 @@ GtScaffolderGraphWalk
 
   while (gt_queue_size(wqueue) != 0) {
     node = (GtScaffolderGraphNode*)gt_queue_get(wqueue);
-    edge = node->edge;
+    eid = gt_scaffolder_bidirected_link_edge(bg, node->edge);
+    edge = graph->edges + eid;
     endvertex = edge->end;
-
-    /* determine opposite direction of twin of edge egde */
-    /* according to SGA: EdgeDir yDir = !pXY->getTwin()->getDir(); */
-    if (edge->same)
-      dir = edge->sense;
-    else
-      dir = !edge->sense;
+    twin = gt_scaffolder_graph_edge_twin(graph, eid);
 
     /* store all terminal vertices */
-    if (gt_scaffolder_graph_isterminal(endvertex))
+    if (gt_scaffolder_graph_isterminal(graph, endvertex))
       gt_array_add(terminal_vertices, endvertex);
 
-    for (eid = 0; eid < endvertex->nof_edges; eid++) {
-      nextedge = endvertex->edges[eid];
-      if (nextedge->sense == dir) {
-        if (!edge_is_marked(nextedge) &&
-            !vertex_is_marked(nextedge->end) &&
-            !is_twin(edge, nextedge))
-        {
-          nextendvertex = nextedge->end;
-
-          distance = node->dist + nextedge->dist;
-
-          /* GT_WORD_MAX is the initial value */
-          GtUword next_endvertex_index =
-            gt_scaffolder_graph_get_vertex_id(graph, nextendvertex);
-          if (distancemap[next_endvertex_index] == GT_WORD_MAX ||
-              distancemap[next_endvertex_index] > distance)
-            {
-              GtScaffolderGraphNode *current_node =
-              gt_malloc(sizeof (*current_node));
-              distancemap[next_endvertex_index] = distance;
-              edgemap[next_endvertex_index] = nextedge;
-
-              current_node->edge = nextedge;
-              current_node->dist = distance;
-
-              gt_queue_add(wqueue, current_node);
-            }
-        }
+    /* the link leads to the side to leave <endvertex> through */
+    side = bg->targets[node->edge];
+    first = gt_scaffolder_bidirected_first_link(bg, side);
+    last = first + gt_scaffolder_bidirected_degree(bg, side);
+    for (lid = first; lid < last; lid++) {
+      eid = gt_scaffolder_bidirected_link_edge(bg, lid);
+      nextedge = graph->edges + eid;
+      if (!edge_is_marked(graph, eid) &&
+          !vertex_is_marked(graph, nextedge->end) &&
+          eid != twin)
+      {
+        nextendvertex = nextedge->end;
+
+        distance = node->dist + nextedge->dist;
+
+        /* GT_WORD_MAX is the initial value */
+        if (distancemap[nextendvertex] == GT_WORD_MAX ||
+            distancemap[nextendvertex] > distance)
+          {
+            GtScaffolderGraphNode *current_node =
+            gt_malloc(sizeof (*current_node));
+            distancemap[nextendvertex] = distance;
+            edgemap[nextendvertex] = eid;
+
+            current_node->edge = lid;
+            current_node->dist = distance;
+
+            gt_queue_add(wqueue, current_node);
+          }
       }
     }
     gt_free(node);
@@ -730,20 +755,17 @@ GtScaffolderGraphWalk
   /* create walk for each found terminal vertex and choose the walk
      with the greatest total contig length */
   while (gt_array_size(terminal_vertices) != 0) {
-    currentvertex =
-      *(GtScaffolderGraphVertex **) gt_array_pop(terminal_vertices);
-    gt_assert(currentvertex < graph->vertices + graph->nof_vertices);
-    gt_assert(currentvertex >= graph->vertices);
+    currentvertex = *(GtUword *) gt_array_pop(terminal_vertices);
+    gt_assert(currentvertex < graph->nof_vertices);
 
     currentwalk = gt_scaffolder_walk_new();
     while (currentvertex != start) {
-      reverseedge = edgemap[gt_scaffolder_graph_get_vertex_id(graph,
-                            currentvertex)];
-      currentvertex = reverseedge->start;
-      gt_scaffolder_walk_addegde(currentwalk, reverseedge);
+      eid = edgemap[currentvertex];
+      currentvertex = gt_scaffolder_graph_edge_start(graph, eid);
+      gt_scaffolder_walk_addegde(graph, currentwalk, eid);
     }
 
-    currentwalk->total_contig_len += start->seq_len;
+    currentwalk->total_contig_len += graph->vertices[start].seq_len;
     lengthcwalk = currentwalk->total_contig_len;
 
     if (lengthcwalk > lengthbestwalk) {
@@ -768,52 +790,45 @@ void gt_scaffolder_makescaffold(GtScaffolderGraph *graph)
 {
   GtUword max_num_bases, i, j;
   GtScaffolderGraphWalk *walk, *bestwalk;
-  GtScaffolderGraphVertex *start;
+  GtUword start;
   GtArray *terminal_vertices, *cc_walks, *ccs;
+  GtScaffolderBidirectedGraph *bg;
 
   gt_assert(graph != NULL);
 
+  /* cycle removal, component search and walk search follow the links
+     between contig sides */
+  bg = gt_scaffolder_bidirected_new(graph);
+
   /* remove cycles */
-  gt_scaffolder_removecycles(graph);
+  gt_scaffolder_removecycles_sides(graph, bg);
 
   cc_walks = gt_array_new(sizeof (walk));
 
   /* create GtArray to store all ccs in it */
   ccs = gt_array_new(sizeof (GtArray *));
 
-  gt_scaffolder_calc_cc_and_terminals(graph, ccs);
+  gt_scaffolder_calc_cc_and_terminals(graph, bg, ccs);
 
   for (i = 0; i < gt_array_size(ccs); i++) {
     terminal_vertices = *(GtArray **) gt_array_get(ccs, i);
 
     /* mark all lonesome vertices as scaffold */
     if (gt_array_size(terminal_vertices) == 1) {
-      GtScaffolderGraphVertex *v;
-      v = *(GtScaffolderGraphVertex **) gt_array_get(terminal_vertices, 0);
-      if (v->nof_edges > 0) {
-        bool lonesome = true;
-        GtUword eid;
-        for (eid = 0; eid < v->nof_edges; eid++) {
-          if (!edge_is_marked(v->edges[eid])) {
-            lonesome = false;
-            break;
-          }
-        }
-        if (lonesome)
-          v->state = GIS_SCAFFOLD;
-      }
-      else
-        v->state = GIS_SCAFFOLD;
+      GtUword v;
+      v = *(GtUword *) gt_array_get(terminal_vertices, 0);
+      /* vertex without unmarked edges */
+      if (gt_scaffolder_graph_active_degree(graph, v, true) == 0 &&
+          gt_scaffolder_graph_active_degree(graph, v, false) == 0)
+        gt_scaffolder_graph_set_vertex_state(graph, v, GIS_SCAFFOLD);
     }
 
     if (gt_array_size(terminal_vertices) > 1) {
       /* calculate all paths between terminal vertices in this cc */
       for (j = 0; j < gt_array_size(terminal_vertices); j++) {
-        start = *(GtScaffolderGraphVertex **)
-                gt_array_get(terminal_vertices, j);
-        gt_assert(start >= graph->vertices);
-        gt_assert(start < graph->vertices + graph->nof_vertices);
-        walk = gt_scaffolder_create_walk(graph, start);
+        start = *(GtUword *) gt_array_get(terminal_vertices, j);
+        gt_assert(start < graph->nof_vertices);
+        walk = gt_scaffolder_create_walk(graph, bg, start);
         if (walk != NULL) {
           gt_array_add(cc_walks, walk);
         }
@@ -833,17 +848,20 @@ void gt_scaffolder_makescaffold(GtScaffolderGraph *graph)
 
     /* mark all nodes and edges in the best walk as GIS_SCAFFOLD */
     if (bestwalk != NULL) {
+      GtUword eid, twin;
       GtWord id;
-      GtUword ed;
-      bestwalk->edges[bestwalk->nof_edges - 1]->start->state = GIS_SCAFFOLD;
+      eid = bestwalk->edges[bestwalk->nof_edges - 1];
+      gt_scaffolder_graph_set_vertex_state(graph,
+        gt_scaffolder_graph_edge_start(graph, eid), GIS_SCAFFOLD);
       for (id = (bestwalk->nof_edges - 1); id >= 0; id--) {
-        bestwalk->edges[id]->state = GIS_SCAFFOLD;
+        eid = bestwalk->edges[id];
+        gt_scaffolder_graph_set_edge_state(graph, eid, GIS_SCAFFOLD);
         /* mark also the twin edges! */
-        for (ed = 0; ed < bestwalk->edges[id]->end->nof_edges; ed++) {
-          if (is_twin(bestwalk->edges[id], bestwalk->edges[id]->end->edges[ed]))
-              bestwalk->edges[id]->end->edges[ed]->state = GIS_SCAFFOLD;
-        }
-        bestwalk->edges[id]->end->state = GIS_SCAFFOLD;
+        twin = gt_scaffolder_graph_edge_twin(graph, eid);
+        if (twin != GT_UNDEF_UWORD)
+          gt_scaffolder_graph_set_edge_state(graph, twin, GIS_SCAFFOLD);
+        gt_scaffolder_graph_set_vertex_state(graph, graph->edges[eid].end,
+                                             GIS_SCAFFOLD);
       }
     }
 
@@ -865,26 +883,92 @@ void gt_scaffolder_makescaffold(GtScaffolderGraph *graph)
 
   gt_array_delete(ccs);
   gt_array_delete(cc_walks);
+  gt_scaffolder_bidirected_delete(bg);
+}
+
+/* transfer the states of <*component> back to <*graph>, vertices marked
+   within the component are marked in <*graph> together with all their edges
+   and twins */
+void gt_scaffolder_graph_merge_component(GtScaffolderGraph *graph,
+                                         const GtScaffolderGraphComponent
+                                         *component)
+{
+  const GtScaffolderGraph *sub;
+  GtUword lvid, vid, leid;
+
+  gt_assert(graph != NULL);
+  gt_assert(component != NULL);
+
+  sub = component->graph;
+  for (lvid = 0; lvid < sub->nof_vertices; lvid++) {
+    vid = component->vertex_ids[lvid];
+    if (vertex_is_marked(sub, lvid) && !vertex_is_marked(graph, vid))
+      mark_vertex(graph, vid, sub->vertex_states[lvid]);
+    else
+      gt_scaffolder_graph_set_vertex_state(graph, vid,
+                                           sub->vertex_states[lvid]);
+  }
+  for (leid = 0; leid < sub->nof_edges; leid++)
+    gt_scaffolder_graph_set_edge_state(graph, component->edge_ids[leid],
+                                       sub->edge_states[leid]);
+}
+
+/* transfer the states of the compacted view <*compacted> back to <*graph>,
+   vertices marked within the view are marked in <*graph> together with all
+   their edges and twins */
+void gt_scaffolder_graph_merge_compacted(GtScaffolderGraph *graph,
+                                         const GtScaffolderGraph *compacted)
+{
+  GtUword vid, eid;
+
+  gt_assert(graph != NULL);
+  gt_assert(compacted != NULL && compacted->edge_ids != NULL);
+  gt_assert(compacted->nof_vertices == graph->nof_vertices);
+
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    if (vertex_is_marked(compacted, vid) && !vertex_is_marked(graph, vid))
+      mark_vertex(graph, vid, compacted->vertex_states[vid]);
+    else
+      gt_scaffolder_graph_set_vertex_state(graph, vid,
+                                           compacted->vertex_states[vid]);
+  }
+  for (eid = 0; eid < compacted->nof_edges; eid++)
+    gt_scaffolder_graph_set_edge_state(graph, compacted->edge_ids[eid],
+                                       compacted->edge_states[eid]);
+}
+
+/* constructs the scaffolds like gt_scaffolder_makescaffold, but works on
+   every connected component separately */
+void gt_scaffolder_makescaffold_components(GtScaffolderGraph *graph)
+{
+  GtScaffolderGraphComponents *components;
+  GtUword cid;
+
+  gt_assert(graph != NULL);
+
+  components = gt_scaffolder_graph_components_new(graph);
+  for (cid = 0; cid < components->nof_components; cid++) {
+    gt_scaffolder_makescaffold(components->components[cid].graph);
+    gt_scaffolder_graph_merge_component(graph, components->components + cid);
+  }
+  gt_scaffolder_graph_components_delete(components);
 }
 
 /* functions to use GtScaffolderGraphRecords */
 GtScaffolderGraphRecord *
-gt_scaffolder_graph_record_new(GtScaffolderGraphVertex *root) {
+gt_scaffolder_graph_record_new(GtUword root) {
   GtScaffolderGraphRecord *rec;
 
-  gt_assert(root != NULL);
-
   rec = gt_malloc(sizeof (*rec));
   rec->root = root;
-  rec->edges = gt_array_new(sizeof (GtScaffolderGraphEdge *));
+  rec->edges = gt_array_new(sizeof (GtUword));
   return rec;
 }
 
 void gt_scaffolder_graph_record_add_edge(GtScaffolderGraphRecord *rec,
-                                         GtScaffolderGraphEdge *edge)
+                                         GtUword edge)
 {
   gt_assert(rec != NULL);
-  gt_assert(edge != NULL);
 
   gt_array_add(rec->edges, edge);
 }
@@ -898,54 +982,54 @@ void gt_scaffolder_graph_record_delete(GtScaffolderGraphRecord *rec) {
 }
 
 /* iterate over graph and return each scaffold in a scaffold record */
-GtArray *gt_scaffolder_graph_iterate_scaffolds(const GtScaffolderGraph *graph,
+GtArray *gt_scaffolder_graph_iterate_scaffolds(GtScaffolderGraph *graph,
                                           GtAssemblyStatsCalculator *scaf_stats)
 {
-  GtScaffolderGraphVertex *vertex, *next_edge_end;
-  GtScaffolderGraphEdge *next_edge, *edge, *unmarked_edge;
+  const GtScaffolderGraphEdge *edge;
   GtScaffolderGraphRecord *rec;
   GtArray *records;
   bool dir;
-  GtUword eid, nof_edges_in_dir, scaf_seqlen, nof_scaffold_edges;
+  GtUword vid, next_edge_end, next_edge, unmarked_edge, twin, eid, first,
+          last, nof_edges_in_dir, scaf_seqlen, nof_scaffold_edges;
 
-  next_edge = NULL;
-  edge = NULL;
-  unmarked_edge = NULL;
+  next_edge = GT_UNDEF_UWORD;
+  unmarked_edge = GT_UNDEF_UWORD;
 
   records = gt_array_new(sizeof (rec));
 
   /* initialize all vertices as not visited */
-  for (vertex = graph->vertices;
-       vertex < (graph->vertices + graph->nof_vertices); vertex++) {
-    if (!vertex_is_marked(vertex) && vertex->state != GIS_SCAFFOLD)
-      vertex->state = GIS_UNVISITED;
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    if (!vertex_is_marked(graph, vid) &&
+        graph->vertex_states[vid] != GIS_SCAFFOLD)
+      gt_scaffolder_graph_set_vertex_state(graph, vid, GIS_UNVISITED);
   }
 
   /* iterate over all vertices */
-  for (vertex = graph->vertices;
-       vertex < (graph->vertices + graph->nof_vertices); vertex++) {
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
 
-    if (vertex->state == GIS_VISITED || vertex_is_marked(vertex))
+    if (graph->vertex_states[vid] == GIS_VISITED ||
+        vertex_is_marked(graph, vid))
       continue;
 
     /* count unmarked edges and save one of them */
     nof_scaffold_edges = 0;
-    for (eid = 0; eid < vertex->nof_edges; eid++) {
-      edge = vertex->edges[eid];
-      if (!edge_is_marked(edge)) {
-        if (edge->state == GIS_SCAFFOLD) {
+    first = gt_scaffolder_graph_first_edge(graph, vid);
+    last = first + gt_scaffolder_graph_degree(graph, vid);
+    for (eid = first; eid < last; eid++) {
+      if (!edge_is_marked(graph, eid)) {
+        if (graph->edge_states[eid] == GIS_SCAFFOLD) {
           nof_scaffold_edges++;
-          unmarked_edge = edge;
+          unmarked_edge = eid;
         }
       }
     }
 
     if (nof_scaffold_edges <= 1) {
       /* found new scaffold */
-      rec = gt_scaffolder_graph_record_new(vertex);
-      scaf_seqlen = vertex->seq_len;
+      rec = gt_scaffolder_graph_record_new(vid);
+      scaf_seqlen = graph->vertices[vid].seq_len;
 
-      vertex->state = GIS_VISITED;
+      gt_scaffolder_graph_set_vertex_state(graph, vid, GIS_VISITED);
 
       if (nof_scaffold_edges == 1) {
 
@@ -954,31 +1038,37 @@ GtArray *gt_scaffolder_graph_iterate_scaffolds(const GtScaffolderGraph *graph,
         while (1) {
           /* store edge in scaffold-record */
           gt_scaffolder_graph_record_add_edge(rec, next_edge);
-          scaf_seqlen += next_edge->dist;
+          edge = graph->edges + next_edge;
+          scaf_seqlen += edge->dist;
 
-          next_edge_end = next_edge->end;
-          scaf_seqlen += next_edge_end->seq_len;
+          next_edge_end = edge->end;
+          scaf_seqlen += graph->vertices[next_edge_end].seq_len;
 
-          if (next_edge_end->state == GIS_VISITED)
+          if (graph->vertex_states[next_edge_end] == GIS_VISITED)
             break;
 
-          next_edge_end->state = GIS_VISITED;
+          gt_scaffolder_graph_set_vertex_state(graph, next_edge_end,
+                                               GIS_VISITED);
 
           /* according to SGA: EdgeDir nextDir = !pXY->getTwin()->getDir(); */
-          if (next_edge->same)
-            dir = next_edge->sense;
+          if (gt_scaffolder_graph_edge_same(edge))
+            dir = gt_scaffolder_graph_edge_sense(edge);
           else
-            dir = !next_edge->sense;
+            dir = !gt_scaffolder_graph_edge_sense(edge);
 
           /* count valid edges (unmarked, no twin) in direction dir
              and save one of them */
           nof_edges_in_dir = 0;
-          for (eid = 0; eid < next_edge_end->nof_edges; eid++) {
-            edge = next_edge_end->edges[eid];
-            if (edge->sense == dir && !edge_is_marked(edge)
-                && !is_twin(next_edge, edge) && edge->state == GIS_SCAFFOLD) {
+          twin = gt_scaffolder_graph_edge_twin(graph, next_edge);
+          first = gt_scaffolder_graph_first_edge_in_dir(graph, next_edge_end,
+                                                        dir);
+          last = first + gt_scaffolder_graph_degree_in_dir(graph,
+                                                           next_edge_end, dir);
+          for (eid = first; eid < last; eid++) {
+            if (!edge_is_marked(graph, eid) && eid != twin &&
+                graph->edge_states[eid] == GIS_SCAFFOLD) {
               nof_edges_in_dir++;
-              unmarked_edge = edge;
+              unmarked_edge = eid;
             }
           }
 
@@ -996,15 +1086,16 @@ GtArray *gt_scaffolder_graph_iterate_scaffolds(const GtScaffolderGraph *graph,
   return records;
 }
 
-/* write scaffold into file */
-int gt_scaffolder_graph_write_scaffold(GtArray *records,
+/* write scaffold of <*graph> into file */
+int gt_scaffolder_graph_write_scaffold(const GtScaffolderGraph *graph,
+                                       GtArray *records,
                                        const char *file_name,
                                        GtError *err)
 {
   GtFile *file;
   GtScaffolderGraphRecord *rec;
-  GtScaffolderGraphEdge *e;
-  GtUword i, j;
+  const GtScaffolderGraphEdge *e;
+  GtUword i, j, eid;
   int had_err = 0;
 
   /* create file */
@@ -1018,17 +1109,19 @@ int gt_scaffolder_graph_write_scaffold(GtArray *records,
     for (i = 0; i < gt_array_size(records); i++) {
       rec = *(GtScaffolderGraphRecord **) gt_array_get(records, i);
 
-      gt_file_xprintf(file, "%s", gt_str_get(rec->root->header_seq));
+      gt_file_xprintf(file, "%s",
+                      gt_scaffolder_graph_vertex_name(graph, rec->root));
 
       for (j = 0; j < gt_array_size(rec->edges); j++) {
-        e = *(GtScaffolderGraphEdge **) gt_array_get(rec->edges, j);
+        eid = *(GtUword *) gt_array_get(rec->edges, j);
+        e = graph->edges + eid;
 
         gt_file_xprintf(file, "\t%s," GT_WD ",%f,%d,%d,",
-                        gt_str_get(e->end->header_seq),
-                        e->dist,
-                        e->std_dev,
-                        e->sense,
-                        e->same);
+                        gt_scaffolder_graph_vertex_name(graph, e->end),
+                        (GtWord) e->dist,
+                        graph->edge_info[eid].std_dev,
+                        gt_scaffolder_graph_edge_sense(e),
+                        gt_scaffolder_graph_edge_same(e));
 
       }
 
@@ -23,15 +23,29 @@
 #ifndef GT_SCAFFOLDER_ALGORITHMS_H
 #define GT_SCAFFOLDER_ALGORITHMS_H
 
-/* write scaffold into file */
-int gt_scaffolder_graph_write_scaffold(GtArray *records,
+/* write scaffold of <*graph> into file */
+int gt_scaffolder_graph_write_scaffold(const GtScaffolderGraph *graph,
+                                       GtArray *records,
                                        const char *file_name,
                                        GtError *err);
 
 /* iterate graph to construct scaffold-records */
-GtArray *gt_scaffolder_graph_iterate_scaffolds(const GtScaffolderGraph *graph,
+GtArray *gt_scaffolder_graph_iterate_scaffolds(GtScaffolderGraph *graph,
                                         GtAssemblyStatsCalculator *scaf_stats);
 
+/* load a-statistics and copy number of every contig from file <filename>
+   into the vertices of <*graph> */
+int gt_scaffolder_graph_load_astat(const char *filename,
+                                   GtScaffolderGraph *graph,
+                                   GtError *err);
+
+/* mark contigs with a-statistics of at most <astat_cutoff> or copy number
+   below <copy_num_cutoff> as repeats, a <copy_num_cutoff> of 0 ignores the
+   copy number */
+void gt_scaffolder_graph_mark_repeat_vertices(GtScaffolderGraph *graph,
+                                              float copy_num_cutoff,
+                                              float astat_cutoff);
+
 /* load astatics and copy number of every contig and mark repeated contigs */
 int gt_scaffolder_graph_mark_repeats(const char *filename,
                                      GtScaffolderGraph *graph,
@@ -52,6 +66,25 @@ void gt_scaffolder_graph_record_delete(GtScaffolderGraphRecord *rec);
    scaffold are marked as GIS_SCAFFOLD. */
 void gt_scaffolder_makescaffold(GtScaffolderGraph *graph);
 
+/* constructs the scaffolds like gt_scaffolder_makescaffold, but extracts
+   every connected component into a graph of its own (see
+   gt_scaffolder_graph_components_new) and scaffolds it there, so the work
+   per component depends only on its size */
+void gt_scaffolder_makescaffold_components(GtScaffolderGraph *graph);
+
+/* transfer the states of the compacted view <*compacted> back to <*graph>,
+   vertices marked within the view are marked in <*graph> together with all
+   their edges and twins (see gt_scaffolder_graph_new_compacted) */
+void gt_scaffolder_graph_merge_compacted(GtScaffolderGraph *graph,
+                                         const GtScaffolderGraph *compacted);
+
+/* transfer the states of <*component> back to <*graph>, vertices marked
+   within the component are marked in <*graph> together with all their edges
+   and twins */
+void gt_scaffolder_graph_merge_component(GtScaffolderGraph *graph,
+                                         const GtScaffolderGraphComponent
+                                         *component);
+
 /* removes cycles in every cc. */
 void gt_scaffolder_removecycles(GtScaffolderGraph *graph);
 
@@ -0,0 +1,90 @@
+/*
+  Copyright (c) 2015 Dorle Osterode, Stefan Dang, Lukas Götz
+  Copyright (c) 2015 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/assert_api.h"
+#include "core/ma_api.h"
+#include "core/minmax.h"
+
+#include "gt_scaffolder_graph.h"
+#include "gt_scaffolder_bidirected.h"
+
+/* convert all edges of <*graph> into links between contig sides. The
+   returned topology stays valid as long as no edge is added to or moved
+   within <*graph>, changes of the states do not affect it. */
+GtScaffolderBidirectedGraph *
+gt_scaffolder_bidirected_new(const GtScaffolderGraph *graph)
+{
+  GtScaffolderBidirectedGraph *bg;
+  const GtScaffolderGraphEdge *edge;
+  GtUword vid, eid, first, lid, side;
+  bool next_sense;
+
+  gt_assert(graph != NULL);
+
+  bg = gt_malloc(sizeof (*bg));
+  bg->nof_sides = 2 * graph->nof_vertices;
+  bg->nof_links = 0;
+  for (vid = 0; vid < graph->nof_vertices; vid++)
+    bg->nof_links += gt_scaffolder_graph_degree(graph, vid);
+  bg->link_offsets = gt_malloc(sizeof (*bg->link_offsets) *
+                               (bg->nof_sides + 1));
+  bg->targets = gt_malloc(sizeof (*bg->targets) * MAX(bg->nof_links, 1));
+  bg->edge_ids = gt_malloc(sizeof (*bg->edge_ids) * MAX(bg->nof_links, 1));
+
+  /* the antisense edges of a vertex precede its sense edges, so the links of
+     both sides are copied in one pass over the edge range */
+  lid = 0;
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    side = gt_scaffolder_bidirected_side(vid, false);
+    bg->link_offsets[side] = lid;
+    bg->link_offsets[side + 1] = lid +
+      gt_scaffolder_graph_degree_in_dir(graph, vid, false);
+    first = gt_scaffolder_graph_first_edge(graph, vid);
+    for (eid = first; eid < first + gt_scaffolder_graph_degree(graph, vid);
+         eid++) {
+      edge = graph->edges + eid;
+      /* according to SGA: EdgeDir yDir = !pXY->getTwin()->getDir(); */
+      if (gt_scaffolder_graph_edge_same(edge))
+        next_sense = gt_scaffolder_graph_edge_sense(edge);
+      else
+        next_sense = !gt_scaffolder_graph_edge_sense(edge);
+      bg->targets[lid] = gt_scaffolder_bidirected_side(edge->end, next_sense);
+      bg->edge_ids[lid] = eid;
+      lid++;
+    }
+  }
+  bg->link_offsets[bg->nof_sides] = lid;
+  gt_assert(lid == bg->nof_links);
+
+  /* every link maps back to the edge it was converted from */
+  for (lid = 0; lid < bg->nof_links; lid++)
+    gt_assert(gt_scaffolder_bidirected_edge_link(bg, graph,
+                gt_scaffolder_bidirected_link_edge(bg, lid)) == lid);
+
+  return bg;
+}
+
+/* delete <*bg> */
+void gt_scaffolder_bidirected_delete(GtScaffolderBidirectedGraph *bg)
+{
+  if (bg == NULL)
+    return;
+  gt_free(bg->link_offsets);
+  gt_free(bg->targets);
+  gt_free(bg->edge_ids);
+  gt_free(bg);
+}
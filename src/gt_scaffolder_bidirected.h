@@ -0,0 +1,84 @@
+/*
+  Copyright (c) 2015 Dorle Osterode, Stefan Dang, Lukas Götz
+  Copyright (c) 2015 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef GT_SCAFFOLDER_BIDIRECTED_H
+#define GT_SCAFFOLDER_BIDIRECTED_H
+
+#include "core/types_api.h"
+
+#include "gt_scaffolder_graph.h"
+
+/* Topology of a scaffold graph with two sides per contig. Side 2 * v of the
+   contig with vertex id v is left by its antisense edges, side 2 * v + 1 by
+   its sense edges. Every edge of the scaffold graph becomes a link from the
+   side it leaves its start vertex through to the side a walk has to leave
+   its end vertex through, which SGA derives as !twin->dir. Following the
+   links is thus an ordinary directed traversal without any orientation
+   logic. The links of side s occupy the slots link_offsets[s] to
+   link_offsets[s + 1] - 1 in the order of the edges of the scaffold graph,
+   the links of both sides of a contig are consecutive. Vertex and edge
+   states stay in the scaffold graph and are looked up through <edge_ids>. */
+typedef struct GtScaffolderBidirectedGraph {
+  GtUword nof_sides;
+  GtUword nof_links;
+  GtScaffolderGraphId *link_offsets;
+  /* side every link leads to */
+  GtScaffolderGraphId *targets;
+  /* edge of the scaffold graph every link was converted from */
+  GtScaffolderGraphId *edge_ids;
+} GtScaffolderBidirectedGraph;
+
+/* returns side of vertex <VID> left by its sense edges if <SENSE> is true and
+   by its antisense edges otherwise */
+#define gt_scaffolder_bidirected_side(VID, SENSE) \
+        (2 * (VID) + ((SENSE) ? 1 : 0))
+
+/* returns vertex id of the contig side <SIDE> belongs to */
+#define gt_scaffolder_bidirected_vertex(SIDE) ((SIDE) / 2)
+
+/* returns true if side <SIDE> is left by sense edges */
+#define gt_scaffolder_bidirected_sense(SIDE) (((SIDE) & 1) != 0)
+
+/* returns id of the first link of side <SIDE> in <BG>, the links of a side
+   have consecutive ids */
+#define gt_scaffolder_bidirected_first_link(BG, SIDE) \
+        ((BG)->link_offsets[SIDE])
+
+/* returns number of links of side <SIDE> in <BG> */
+#define gt_scaffolder_bidirected_degree(BG, SIDE) \
+        ((BG)->link_offsets[(SIDE) + 1] - (BG)->link_offsets[SIDE])
+
+/* returns the edge of the scaffold graph link <LID> of <BG> stands for */
+#define gt_scaffolder_bidirected_link_edge(BG, LID) ((BG)->edge_ids[LID])
+
+/* returns the link of <BG> edge <EID> of <GRAPH>, which <BG> was converted
+   from, is turned into */
+#define gt_scaffolder_bidirected_edge_link(BG, GRAPH, EID) \
+        ((BG)->link_offsets[2 * gt_scaffolder_graph_edge_start(GRAPH, EID)] + \
+         ((EID) - gt_scaffolder_graph_first_edge(GRAPH, \
+                    gt_scaffolder_graph_edge_start(GRAPH, EID))))
+
+/* convert all edges of <*graph> into links between contig sides. The
+   returned topology stays valid as long as no edge is added to or moved
+   within <*graph>, changes of the states do not affect it. */
+GtScaffolderBidirectedGraph *
+gt_scaffolder_bidirected_new(const GtScaffolderGraph *graph);
+
+/* delete <*bg> */
+void gt_scaffolder_bidirected_delete(GtScaffolderBidirectedGraph *bg);
+
+#endif
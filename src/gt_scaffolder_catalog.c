@@ -0,0 +1,414 @@
+/*
+  Copyright (c) 2015 Dorle Osterode, Stefan Dang, Lukas Götz
+  Copyright (c) 2015 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <sys/stat.h>
+
+#include "core/assert_api.h"
+#include "core/cstr_api.h"
+#include "core/ma_api.h"
+#include "core/minmax.h"
+#include "core/str_api.h"
+#include "core/xansi_api.h"
+
+#include "gt_scaffolder_catalog.h"
+#include "gt_scaffolder_linereader.h"
+
+/* initial number of contigs and of bytes of the name pool */
+#define GT_SCAFFOLDER_CATALOG_INIT_SIZE 1024
+
+/* returns newly allocated file name of the index of FASTA file
+   <fasta_filename> */
+static char *gt_scaffolder_catalog_index_filename(const char *fasta_filename)
+{
+  char *index_filename;
+  GtUword len;
+
+  len = strlen(fasta_filename);
+  index_filename = gt_malloc(sizeof (*index_filename) * (len + 5));
+  memcpy(index_filename, fasta_filename, len);
+  memcpy(index_filename + len, ".fai", 5);
+  return index_filename;
+}
+
+/* append contig with header <name> of length <name_length> to <*catalog>
+   and return its entry */
+static GtScaffolderCatalogEntry *
+gt_scaffolder_catalog_add(GtScaffolderCatalog *catalog,
+                          const char *name,
+                          GtUword name_length)
+{
+  GtScaffolderCatalogEntry *entry;
+
+  if (catalog->nof_entries == catalog->max_nof_entries) {
+    catalog->max_nof_entries = MAX(2 * catalog->max_nof_entries,
+                                   GT_SCAFFOLDER_CATALOG_INIT_SIZE);
+    catalog->entries = gt_realloc(catalog->entries,
+                                  sizeof (*catalog->entries) *
+                                  catalog->max_nof_entries);
+  }
+  while (catalog->names_length + name_length + 1 > catalog->names_size) {
+    catalog->names_size = MAX(2 * catalog->names_size,
+                              GT_SCAFFOLDER_CATALOG_INIT_SIZE);
+    catalog->names = gt_realloc(catalog->names, sizeof (*catalog->names) *
+                                catalog->names_size);
+  }
+
+  entry = catalog->entries + catalog->nof_entries++;
+  entry->name_offset = catalog->names_length;
+  entry->name_length = name_length;
+  entry->length = 0;
+  entry->offset = 0;
+  entry->line_bases = 0;
+  entry->line_width = 0;
+  memcpy(catalog->names + catalog->names_length, name, name_length);
+  catalog->names[catalog->names_length + name_length] = '\0';
+  catalog->names_length += name_length + 1;
+
+  return entry;
+}
+
+/* remove all contigs from <*catalog> */
+static void gt_scaffolder_catalog_reset(GtScaffolderCatalog *catalog)
+{
+  catalog->nof_entries = 0;
+  catalog->names_length = 0;
+  catalog->regular = true;
+}
+
+/* returns the number of bytes of the lines of <*entry> with all line
+   terminators but the one of the last line */
+static GtUword gt_scaffolder_catalog_entry_bytes(const GtScaffolderCatalogEntry
+                                                 *entry)
+{
+  GtUword nof_lines;
+
+  gt_assert(entry->length > 0 && entry->line_bases > 0);
+  nof_lines = (entry->length + entry->line_bases - 1) / entry->line_bases;
+  return (nof_lines - 1) * entry->line_width + entry->length -
+         (nof_lines - 1) * entry->line_bases;
+}
+
+/* returns true if the index with status <index_sb> was written after the
+   last change of the FASTA file with status <fasta_sb>. The change time is
+   compared, as copies keeping the modification time still change it. */
+static bool gt_scaffolder_catalog_index_is_newer(const struct stat *index_sb,
+                                                 const struct stat *fasta_sb)
+{
+  return index_sb->st_mtim.tv_sec > fasta_sb->st_ctim.tv_sec ||
+         (index_sb->st_mtim.tv_sec == fasta_sb->st_ctim.tv_sec &&
+          index_sb->st_mtim.tv_nsec > fasta_sb->st_ctim.tv_nsec);
+}
+
+/* read the contigs of <*catalog> from index <index_filename>. Returns false
+   if the index can not be read or is malformed. */
+static bool gt_scaffolder_catalog_read_index(GtScaffolderCatalog *catalog,
+                                             const char *index_filename)
+{
+  GtScaffolderLineReader *reader;
+  GtScaffolderCatalogEntry *entry;
+  GtUword line_len, name_length, length, offset, line_bases, line_width;
+  char *line;
+  bool valid = true;
+
+  reader = gt_scaffolder_line_reader_new(index_filename);
+  if (reader == NULL)
+    return false;
+
+  /* every line holds name, length, offset, line bases and line width */
+  while (valid && gt_scaffolder_line_reader_next(reader, &line, &line_len)) {
+    name_length = strcspn(line, "\t");
+    valid = name_length > 0 && name_length < line_len &&
+            sscanf(line + name_length, "\t" GT_WU "\t" GT_WU "\t" GT_WU "\t"
+                   GT_WU, &length, &offset, &line_bases, &line_width) == 4 &&
+            length > 0 && line_bases > 0 && line_width > line_bases;
+    if (valid) {
+      entry = gt_scaffolder_catalog_add(catalog, line, name_length);
+      entry->length = length;
+      entry->offset = offset;
+      entry->line_bases = line_bases;
+      entry->line_width = line_width;
+    }
+  }
+  gt_scaffolder_line_reader_delete(reader);
+
+  return valid && catalog->nof_entries > 0;
+}
+
+/* check that <*entry> of <*catalog> has at least one base */
+static int gt_scaffolder_catalog_check_entry(const GtScaffolderCatalog
+                                             *catalog,
+                                             const GtScaffolderCatalogEntry
+                                             *entry,
+                                             GtError *err)
+{
+  if (entry != NULL && entry->length == 0) {
+    gt_error_set(err, "Invalid sequence length of contig %s in FASTA file "
+                      "%s", catalog->names + entry->name_offset,
+                 catalog->fasta_filename);
+    return -1;
+  }
+  return 0;
+}
+
+/* collect the contigs of <*catalog> by scanning its FASTA file once, only
+   the line layout of every contig is kept */
+static int gt_scaffolder_catalog_scan_fasta(GtScaffolderCatalog *catalog,
+                                            GtError *err)
+{
+  GtScaffolderLineReader *reader;
+  GtScaffolderCatalogEntry *entry = NULL;
+  GtUword line_len, bases, offset, name_length;
+  bool short_line = false;
+  char *line;
+  int had_err = 0;
+
+  reader = gt_scaffolder_line_reader_new(catalog->fasta_filename);
+  if (reader == NULL) {
+    gt_error_set(err, "can not read FASTA file %s", catalog->fasta_filename);
+    return -1;
+  }
+
+  offset = 0;
+  while (had_err == 0 &&
+         gt_scaffolder_line_reader_next(reader, &line, &line_len)) {
+    /* bases of the line without the terminator of DOS line ends */
+    bases = line_len > 0 && line[line_len - 1] == '\r' ? line_len - 1
+                                                        : line_len;
+    if (bases > 0 && line[0] == '>') {
+      had_err = gt_scaffolder_catalog_check_entry(catalog, entry, err);
+      if (had_err == 0) {
+        /* the header is cut after the first space */
+        line[bases] = '\0';
+        name_length = strcspn(line + 1, " ");
+        if (name_length == 0) {
+          gt_error_set(err, "Invalid header length in FASTA file %s",
+                       catalog->fasta_filename);
+          had_err = -1;
+        }
+        else {
+          entry = gt_scaffolder_catalog_add(catalog, line + 1, name_length);
+          entry->offset = offset + line_len + 1;
+          short_line = false;
+        }
+      }
+    }
+    else if (entry == NULL) {
+      if (bases > 0) {
+        gt_error_set(err, "sequence before the first header in FASTA file "
+                          "%s", catalog->fasta_filename);
+        had_err = -1;
+      }
+    }
+    else if (bases == 0) {
+      /* an empty line only ends the contig */
+      short_line = true;
+    }
+    else {
+      /* all lines but the last of a contig need the same length */
+      if (entry->length == 0 && !short_line) {
+        entry->line_bases = bases;
+        entry->line_width = line_len + 1;
+      }
+      else if (short_line || bases > entry->line_bases ||
+               (bases == entry->line_bases &&
+                line_len + 1 != entry->line_width)) {
+        entry->line_bases = 0;
+        catalog->regular = false;
+      }
+      if (bases < entry->line_bases)
+        short_line = true;
+      entry->length += bases;
+    }
+    offset += line_len + 1;
+  }
+  gt_scaffolder_line_reader_delete(reader);
+
+  if (had_err == 0)
+    had_err = gt_scaffolder_catalog_check_entry(catalog, entry, err);
+
+  return had_err;
+}
+
+/* create catalog of the contigs of FASTA file <fasta_filename> from its
+   index if it is up to date, by scanning the FASTA file otherwise. Returns
+   NULL and sets <err> if the FASTA file is invalid. */
+GtScaffolderCatalog *gt_scaffolder_catalog_new(const char *fasta_filename,
+                                               GtError *err)
+{
+  GtScaffolderCatalog *catalog;
+  const GtScaffolderCatalogEntry *last;
+  struct stat fasta_sb, index_sb;
+  char *index_filename;
+  bool from_index = false;
+  int had_err = 0;
+
+  catalog = gt_malloc(sizeof (*catalog));
+  catalog->fasta_filename = gt_cstr_dup(fasta_filename);
+  catalog->entries = NULL;
+  catalog->max_nof_entries = 0;
+  catalog->names = NULL;
+  catalog->names_size = 0;
+  gt_scaffolder_catalog_reset(catalog);
+
+  if (stat(fasta_filename, &fasta_sb) != 0) {
+    gt_error_set(err, "can not read FASTA file %s", fasta_filename);
+    had_err = -1;
+  }
+
+  /* an index not newer than the FASTA file is ignored like a malformed one,
+     as is an index whose last contig does not fit into the FASTA file */
+  if (had_err == 0) {
+    index_filename = gt_scaffolder_catalog_index_filename(fasta_filename);
+    if (stat(index_filename, &index_sb) == 0 &&
+        gt_scaffolder_catalog_index_is_newer(&index_sb, &fasta_sb))
+      from_index = gt_scaffolder_catalog_read_index(catalog, index_filename);
+    gt_free(index_filename);
+  }
+  if (from_index) {
+    last = catalog->entries + catalog->nof_entries - 1;
+    from_index = last->offset + gt_scaffolder_catalog_entry_bytes(last) <=
+                 (GtUword) fasta_sb.st_size;
+  }
+
+  if (had_err == 0 && !from_index) {
+    gt_scaffolder_catalog_reset(catalog);
+    had_err = gt_scaffolder_catalog_scan_fasta(catalog, err);
+  }
+
+  if (had_err != 0) {
+    gt_scaffolder_catalog_delete(catalog);
+    return NULL;
+  }
+  return catalog;
+}
+
+/* delete <*catalog> */
+void gt_scaffolder_catalog_delete(GtScaffolderCatalog *catalog)
+{
+  if (catalog == NULL)
+    return;
+  gt_free(catalog->fasta_filename);
+  gt_free(catalog->entries);
+  gt_free(catalog->names);
+  gt_free(catalog);
+}
+
+/* write <*catalog> into the index <fasta file>.fai of its FASTA file, which
+   is reused by later calls of gt_scaffolder_catalog_new */
+int gt_scaffolder_catalog_write_index(const GtScaffolderCatalog *catalog,
+                                      GtError *err)
+{
+  const GtScaffolderCatalogEntry *entry;
+  char *index_filename;
+  FILE *file;
+  GtUword cid;
+  int had_err = 0;
+
+  gt_assert(catalog != NULL);
+
+  if (!catalog->regular) {
+    gt_error_set(err, "contigs of FASTA file %s differ in line length and "
+                      "can not be indexed", catalog->fasta_filename);
+    return -1;
+  }
+
+  index_filename = gt_scaffolder_catalog_index_filename(
+                     catalog->fasta_filename);
+  file = fopen(index_filename, "w");
+  if (file == NULL) {
+    gt_error_set(err, "can not write index file %s", index_filename);
+    had_err = -1;
+  }
+  else {
+    for (cid = 0; cid < catalog->nof_entries; cid++) {
+      entry = catalog->entries + cid;
+      fprintf(file, "%s\t" GT_WU "\t" GT_WU "\t" GT_WU "\t" GT_WU "\n",
+              catalog->names + entry->name_offset, entry->length,
+              entry->offset, entry->line_bases, entry->line_width);
+    }
+    if (fclose(file) != 0) {
+      gt_error_set(err, "can not write index file %s", index_filename);
+      had_err = -1;
+    }
+    /* an incomplete index must not be taken for an up to date one */
+    if (had_err != 0)
+      remove(index_filename);
+  }
+  gt_free(index_filename);
+
+  return had_err;
+}
+
+/* read the bases of contig <cid> of <*catalog> from its FASTA file into
+   <seq> without reading any other contig */
+int gt_scaffolder_catalog_get_sequence(const GtScaffolderCatalog *catalog,
+                                       GtUword cid,
+                                       GtStr *seq,
+                                       GtError *err)
+{
+  const GtScaffolderCatalogEntry *entry;
+  GtUword nof_bytes, i;
+  struct stat sb;
+  FILE *file;
+  char *buffer;
+  int had_err = 0;
+
+  gt_assert(catalog != NULL && cid < catalog->nof_entries);
+
+  entry = catalog->entries + cid;
+  if (entry->line_bases == 0) {
+    gt_error_set(err, "lines of contig %s in FASTA file %s differ in length",
+                 catalog->names + entry->name_offset,
+                 catalog->fasta_filename);
+    return -1;
+  }
+
+  file = fopen(catalog->fasta_filename, "rb");
+  if (file == NULL) {
+    gt_error_set(err, "can not read FASTA file %s", catalog->fasta_filename);
+    return -1;
+  }
+
+  /* the last line ends the file if it has no terminator */
+  nof_bytes = gt_scaffolder_catalog_entry_bytes(entry);
+  if (fstat(fileno(file), &sb) != 0 || (GtUword) sb.st_size < entry->offset)
+    nof_bytes = 0;
+  else
+    nof_bytes = MIN(nof_bytes, (GtUword) sb.st_size - entry->offset);
+
+  buffer = gt_malloc(sizeof (*buffer) * (nof_bytes + 1));
+  gt_xfseek(file, (long) entry->offset, SEEK_SET);
+  nof_bytes = gt_xfread(buffer, 1, nof_bytes, file);
+  fclose(file);
+
+  gt_str_reset(seq);
+  for (i = 0; i < nof_bytes; i++) {
+    if (buffer[i] != '\n' && buffer[i] != '\r')
+      gt_str_append_char(seq, buffer[i]);
+  }
+  gt_free(buffer);
+
+  if (gt_str_length(seq) != entry->length) {
+    gt_error_set(err, "FASTA file %s is shorter than its index",
+                 catalog->fasta_filename);
+    had_err = -1;
+  }
+
+  return had_err;
+}
@@ -0,0 +1,98 @@
+/*
+  Copyright (c) 2015 Dorle Osterode, Stefan Dang, Lukas Götz
+  Copyright (c) 2015 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef GT_SCAFFOLDER_CATALOG_H
+#define GT_SCAFFOLDER_CATALOG_H
+
+#include <stdbool.h>
+
+#include "core/error_api.h"
+#include "core/str_api.h"
+#include "core/types_api.h"
+
+/* contig of a FASTA file as described by a line of a .fai index */
+typedef struct {
+  /* header up to the first space, offset into the name pool */
+  GtUword name_offset;
+  GtUword name_length;
+  /* number of bases */
+  GtUword length;
+  /* byte offset of the first base in the FASTA file */
+  GtUword offset;
+  /* bases and bytes including the line terminator of every full line, 0 if
+     the lines of the contig differ in length */
+  GtUword line_bases;
+  GtUword line_width;
+} GtScaffolderCatalogEntry;
+
+/* Catalog of the contigs of a FASTA file in file order. It is read from the
+   sidecar index <fasta file>.fai in the format of samtools faidx if that was
+   written after the last change of the FASTA file and its contigs fit into
+   the FASTA file, otherwise the FASTA file is scanned once without keeping
+   any sequence. */
+typedef struct GtScaffolderCatalog {
+  char *fasta_filename;
+  GtScaffolderCatalogEntry *entries;
+  GtUword nof_entries;
+  GtUword max_nof_entries;
+  /* null terminated contig headers */
+  char *names;
+  GtUword names_length;
+  GtUword names_size;
+  /* true if every contig has a regular line layout, which the index format
+     requires */
+  bool regular;
+} GtScaffolderCatalog;
+
+/* returns number of contigs of <CATALOG> */
+#define gt_scaffolder_catalog_nof_contigs(CATALOG) ((CATALOG)->nof_entries)
+
+/* returns null terminated header of contig <CID> of <CATALOG> up to the
+   first space */
+#define gt_scaffolder_catalog_name(CATALOG, CID) \
+        ((CATALOG)->names + (CATALOG)->entries[CID].name_offset)
+
+/* returns length of the header of contig <CID> of <CATALOG> */
+#define gt_scaffolder_catalog_name_length(CATALOG, CID) \
+        ((CATALOG)->entries[CID].name_length)
+
+/* returns number of bases of contig <CID> of <CATALOG> */
+#define gt_scaffolder_catalog_length(CATALOG, CID) \
+        ((CATALOG)->entries[CID].length)
+
+/* create catalog of the contigs of FASTA file <fasta_filename> from its
+   index if it is up to date, by scanning the FASTA file otherwise. Returns
+   NULL and sets <err> if the FASTA file is invalid. */
+GtScaffolderCatalog *gt_scaffolder_catalog_new(const char *fasta_filename,
+                                               GtError *err);
+
+/* delete <*catalog> */
+void gt_scaffolder_catalog_delete(GtScaffolderCatalog *catalog);
+
+/* write <*catalog> into the index <fasta file>.fai of its FASTA file, which
+   is reused by later calls of gt_scaffolder_catalog_new */
+int gt_scaffolder_catalog_write_index(const GtScaffolderCatalog *catalog,
+                                      GtError *err);
+
+/* read the bases of contig <cid> of <*catalog> from its FASTA file into
+   <seq> without reading any other contig */
+int gt_scaffolder_catalog_get_sequence(const GtScaffolderCatalog *catalog,
+                                       GtUword cid,
+                                       GtStr *seq,
+                                       GtError *err);
+
+#endif
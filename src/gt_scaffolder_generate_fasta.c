@@ -96,23 +96,24 @@ void gt_scaffolder_graph_reverse_complement_gt_str(GtStr *str) {
   }
 }
 
-static GtUword gt_scaffolder_graph_graph_resolve(GtScaffolderGraphEdge *edge,
-                                                 GtStr *resv_seq,
-                                                 GtStrgraph *strgraph,
-                                                 GtEncseq *encseq,
-                                                 GtHashmap *contigs)
+static GtUword
+gt_scaffolder_graph_graph_resolve(const GtScaffolderGraph *graph,
+                                  GtUword edge,
+                                  GtStr *resv_seq,
+                                  GtStrgraph *strgraph,
+                                  GtEncseq *encseq)
 {
-  GtUword i, j;
+  const GtScaffolderGraphEdge *e;
   GtUword ret;
 
-  gt_assert(edge != NULL);
+  gt_assert(graph != NULL);
   gt_assert(resv_seq != NULL);
 
-  i = (GtUword) gt_hashmap_get(contigs, gt_str_get(edge->start->header_seq));
-  j = (GtUword) gt_hashmap_get(contigs, gt_str_get(edge->end->header_seq));
-
-  ret = gt_strgraph_traverse_from_to(strgraph, encseq, i, j,
-          edge->dist, edge->sense, resv_seq);
+  e = graph->edges + edge;
+  ret = gt_strgraph_traverse_from_to(strgraph, encseq,
+          graph->vertices[gt_scaffolder_graph_edge_start(graph, edge)].seqnum,
+          graph->vertices[e->end].seqnum,
+          e->dist, gt_scaffolder_graph_edge_sense(e), resv_seq);
 
   return ret;
 }
@@ -139,7 +140,8 @@ static void gt_scaffolder_graph_best_alignment_by_distance(GtUword u_len,
   }
 }
 
-static bool gt_scaffolder_graph_overlap_resolve(GtScaffolderGraphEdge *edge,
+static bool gt_scaffolder_graph_overlap_resolve(const GtScaffolderGraph *graph,
+                                                GtUword edge,
                                                 GtStr *seq,
                                                 GtStr *next_seq,
                                                 GtStr *resv_seq,
@@ -151,7 +153,7 @@ static bool gt_scaffolder_graph_overlap_resolve(GtScaffolderGraphEdge *edge,
   GtUword align_len;
   GtScaffolderGraphAlignmentData data;
 
-  gt_assert(edge != NULL);
+  gt_assert(graph != NULL);
   gt_assert(seq != NULL);
   gt_assert(next_seq != NULL);
   gt_assert(resv_seq != NULL);
@@ -159,7 +161,8 @@ static bool gt_scaffolder_graph_overlap_resolve(GtScaffolderGraphEdge *edge,
   if (gt_str_length(seq) != 0 && gt_str_length(next_seq) != 0) {
 
     /* set upper bound for overlap */
-    upper_bound = (GtUword) -1 * edge->dist + 3.0f * edge->std_dev;
+    upper_bound = (GtUword) -1 * graph->edges[edge].dist +
+                  3.0f * graph->edge_info[edge].std_dev;
     if (upper_bound > max_alignment_length)
       return false;
 
@@ -203,21 +206,23 @@ static bool gt_scaffolder_graph_overlap_resolve(GtScaffolderGraphEdge *edge,
   return false;
 }
 
-static void gt_scaffolder_graph_introduce_gap(GtScaffolderGraphEdge *edge,
+static void gt_scaffolder_graph_introduce_gap(const GtScaffolderGraph *graph,
+                                              GtUword edge,
                                               GtUword min_gap_length,
                                               GtStr *next_seq,
                                               GtStr *resv_seq) {
-  gt_assert(edge != NULL);
+  gt_assert(graph != NULL);
   gt_assert(next_seq != NULL);
   gt_assert(resv_seq != NULL);
 
   char *seq = NULL;
   char *next_cseq = gt_str_get(next_seq);
   GtUword next_seq_len = gt_str_length(next_seq);
+  GtWord dist = graph->edges[edge].dist;
 
   /* overlap couldn't be resolved */
-  if (edge->dist < 0) {
-    GtWord overlap = edge->dist * -1;
+  if (dist < 0) {
+    GtWord overlap = dist * -1;
     GtUword rest_len = next_seq_len - overlap;
     GtUword len = min_gap_length + rest_len + 1;
     seq = gt_malloc(len * sizeof (*seq));
@@ -229,7 +234,7 @@ static void gt_scaffolder_graph_introduce_gap(GtScaffolderGraphEdge *edge,
     gt_assert(seq[len-1] == '\0');
   }
   else {
-    GtUword gap_len = MAX(edge->dist, min_gap_length);
+    GtUword gap_len = MAX(dist, min_gap_length);
     GtUword len = gap_len + next_seq_len + 1;
     seq = gt_malloc(len * sizeof (*seq));
 
@@ -274,11 +279,11 @@ static void gt_scaffolder_graph_get_sequence(GtEncseq *encseq,
   GT_FREEARRAY(&contig_seq, char);
 }
 
-GtStr *gt_scaffolder_graph_generate_string(GtScaffolderGraphRecord *rec,
+GtStr *gt_scaffolder_graph_generate_string(const GtScaffolderGraph *graph,
+                                           GtScaffolderGraphRecord *rec,
                                            GtStr *ids,
                                            GtStrgraph *strgraph,
                                            GtEncseq *encseq,
-                                           GtHashmap *contigs,
                                            struct GtScaffolderGraphResolveStats
                                            *stats) {
   GtStr *seq, *root_id;
@@ -287,20 +292,21 @@ GtStr *gt_scaffolder_graph_generate_string(GtScaffolderGraphRecord *rec,
 
   /* initialize seq with gt_str of the root-node of rec. we need
      the sequence for that */
-  seqnum = (GtUword) gt_hashmap_get(contigs, gt_str_get(rec->root->header_seq));
+  seqnum = graph->vertices[rec->root].seqnum;
 
   seq = gt_str_new();
 
   gt_scaffolder_graph_get_sequence(encseq, seqnum, seq);
 
   id_array = gt_array_new(sizeof (GtStr *));
-  root_id = gt_str_clone(rec->root->header_seq);
+  root_id = gt_str_new_cstr(gt_scaffolder_graph_vertex_name(graph,
+                                                            rec->root));
   gt_str_append_char(root_id, '+');
   gt_array_add(id_array, root_id);
 
   if (gt_array_size(rec->edges) > 0) {
-    GtUword i;
-    GtScaffolderGraphEdge *edge;
+    GtUword i, edge;
+    const GtScaffolderGraphEdge *e;
     GtStr *resv_seq = gt_str_new();
     GtStr *out_id;
     bool resolved = false;
@@ -310,8 +316,8 @@ GtStr *gt_scaffolder_graph_generate_string(GtScaffolderGraphRecord *rec,
     bool prev_comp = true;
 
     /* set root direction */
-    edge = *(GtScaffolderGraphEdge **)gt_array_get(rec->edges, 0);
-    root_dir = edge->sense;
+    edge = *(GtUword *) gt_array_get(rec->edges, 0);
+    root_dir = gt_scaffolder_graph_edge_sense(graph->edges + edge);
 
     if (!root_dir)
       gt_scaffolder_graph_reverse_gt_str(seq);
@@ -320,15 +326,16 @@ GtStr *gt_scaffolder_graph_generate_string(GtScaffolderGraphRecord *rec,
     for (i = 0; i < gt_array_size(rec->edges); i++) {
       stats->num_gaps++;
       gt_str_reset(resv_seq);
-      edge = *(GtScaffolderGraphEdge **)gt_array_get(rec->edges, i);
+      edge = *(GtUword *) gt_array_get(rec->edges, i);
+      e = graph->edges + edge;
 
       /* store relative composition to root-contig */
-      if (!edge->same)
+      if (!gt_scaffolder_graph_edge_same(e))
         rel_comp = rel_comp ? false : true;
 
       /* try to find unique walk through graph to resolve the gap */
-      ret = gt_scaffolder_graph_graph_resolve(edge, resv_seq,
-                                              strgraph, encseq, contigs);
+      ret = gt_scaffolder_graph_graph_resolve(graph, edge, resv_seq,
+                                              strgraph, encseq);
 
       if (ret == 3) {
         stats->graph_resolved++;
@@ -352,7 +359,7 @@ GtStr *gt_scaffolder_graph_generate_string(GtScaffolderGraphRecord *rec,
 
         /* get the sequence of edge->end.  maybe this initialization
            is not needed! */
-        seqnum = (GtUword) gt_hashmap_get(contigs, edge->end->header_seq);
+        seqnum = graph->vertices[e->end].seqnum;
 
         gt_scaffolder_graph_get_sequence(encseq, seqnum, next_seq);
 
@@ -363,10 +370,10 @@ GtStr *gt_scaffolder_graph_generate_string(GtScaffolderGraphRecord *rec,
         if (!root_dir)
           gt_scaffolder_graph_reverse_gt_str(next_seq);
 
-        if (edge->dist < 0) {
+        if (e->dist < 0) {
           /* SGA defaults: max_error = 0.05, min_overlap = 20 */
           stats->overlap_try++;
-          resolved = gt_scaffolder_graph_overlap_resolve(edge, seq,
+          resolved = gt_scaffolder_graph_overlap_resolve(graph, edge, seq,
                                                          next_seq, resv_seq,
                                                          0.05, 20);
         }
@@ -374,7 +381,8 @@ GtStr *gt_scaffolder_graph_generate_string(GtScaffolderGraphRecord *rec,
         /* introduce a gap between the contigs */
         if (!resolved && ret != 3) {
           /* TODO: calculate min_gap_length */
-          gt_scaffolder_graph_introduce_gap(edge, 25, next_seq, resv_seq);
+          gt_scaffolder_graph_introduce_gap(graph, edge, 25, next_seq,
+                                            resv_seq);
           stats->unresolved++;
         }
         else
@@ -386,7 +394,7 @@ GtStr *gt_scaffolder_graph_generate_string(GtScaffolderGraphRecord *rec,
       /* get the header of the current end-vertex and add the sense
          information */
       gt_str_append_str(seq, resv_seq);
-      out_id = gt_str_clone(edge->end->header_seq);
+      out_id = gt_str_new_cstr(gt_scaffolder_graph_vertex_name(graph, e->end));
       gt_str_append_char(out_id, rel_comp ? '+' : '-');
       gt_array_add(id_array, out_id);
 
@@ -446,7 +454,8 @@ GtStr *gt_scaffolder_graph_generate_string(GtScaffolderGraphRecord *rec,
   - had_err
  */
 
-int gt_scaffolder_graph_generate_fasta(char *contig_file,
+int gt_scaffolder_graph_generate_fasta(const GtScaffolderGraph *graph,
+                                       char *contig_file,
                                        char *spm_file,
                                        char *fasta_file,
                                        GtArray *recs,
@@ -498,28 +507,16 @@ int gt_scaffolder_graph_generate_fasta(char *contig_file,
     }
 
     if (had_err == 0) {
-      const char *desc;
       GtFile *out;
       GtStr *ids, *seq;
       GtUword i;
       GtScaffolderGraphRecord *rec;
-      GtUword desc_len;
-      char contig[1025];
-      GtWord seq_num;
       const char *cseq;
       GtUword len;
       struct GtScaffolderGraphResolveStats stats;
-      GtHashmap *contigs = gt_hashmap_new(GT_HASH_STRING, gt_free_func, NULL);
-
-      for (seq_num = 0; seq_num < gt_encseq_num_of_sequences(encseq);
-           seq_num ++) {
-        desc = gt_encseq_description(encseq, &desc_len, seq_num);
 
-        memcpy(contig, desc, desc_len);
-        contig[desc_len] = '\0';
-
-        gt_hashmap_add(contigs, gt_cstr_dup(contig), (void *) seq_num);
-      }
+      /* the vertices of the scaffold graph know the number of their contig
+         in the FASTA file, which is also the sequence number in <encseq> */
 
       /* prepare stats */
       stats.graph_resolved = 0;
@@ -545,7 +542,6 @@ int gt_scaffolder_graph_generate_fasta(char *contig_file,
       if (had_err != 0) {
         gt_str_delete(ids);
         gt_file_delete(out);
-        gt_hashmap_delete(contigs);
         gt_encseq_delete(encseq);
         gt_strgraph_delete(strgraph);
 
@@ -555,8 +551,8 @@ int gt_scaffolder_graph_generate_fasta(char *contig_file,
       for (i = 0; i < gt_array_size(recs); i++) {
         rec = *(GtScaffolderGraphRecord **) gt_array_get(recs, i);
         gt_str_set(ids, "> ");
-        seq = gt_scaffolder_graph_generate_string(rec, ids, strgraph,
-                                                  encseq, contigs, &stats);
+        seq = gt_scaffolder_graph_generate_string(graph, rec, ids, strgraph,
+                                                  encseq, &stats);
         /* write seq to fasta file */
         gt_file_xfputs(gt_str_get(ids), out);
         gt_file_xfputs("\n", out);
@@ -577,8 +573,6 @@ int gt_scaffolder_graph_generate_fasta(char *contig_file,
 
       gt_file_delete(out);
 
-      gt_hashmap_delete(contigs);
-
       /* print stats */
       printf("number of gaps attempted:" GT_WU "\n", stats.num_gaps);
       printf("resolved with graph:" GT_WU "\n", stats.graph_resolved);
@@ -15,7 +15,10 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
-int gt_scaffolder_graph_generate_fasta(char *contig_file,
+#include "gt_scaffolder_graph.h"
+
+int gt_scaffolder_graph_generate_fasta(const GtScaffolderGraph *graph,
+				       char *contig_file,
 				       char *spm_file,
 				       char *fasta_file,
 				       GtArray *recs,
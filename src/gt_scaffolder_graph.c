@@ -15,20 +15,91 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <errno.h>
+#include <fcntl.h>
 #include <stdbool.h>
+#include <stdint.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include "core/file_api.h"
 #include "core/ma_api.h"
+#include "core/minmax.h"
 #include "core/str_api.h"
+#include "core/undef_api.h"
+#include "core/xansi_api.h"
+#include "core/xposix.h"
 
 #include "gt_scaffolder_graph.h"
 #include "gt_scaffolder_parser.h"
 
+/* initial number of vertices and staged edges of GtScaffolderGraphBuilder */
+#define GT_SCAFFOLDER_GRAPH_BUILDER_INIT_SIZE 1024
+
+/* maximal number of digits of a numbered contig header, the number fits into
+   32 bits */
+#define GT_SCAFFOLDER_GRAPH_MAX_NUMBER_DIGITS 9
+
+/* maximal number of slots per vertex of the table from number to vertex,
+   contigs filtered by length leave gaps in the numbering */
+#define GT_SCAFFOLDER_GRAPH_NUMBER_INDEX_FACTOR 4
+
+/* Allocate graph data structure <*GtScaffolderGraph> without vertex and edge
+   portion */
+static GtScaffolderGraph *gt_scaffolder_graph_new_empty(void)
+{
+  GtScaffolderGraph *graph;
+
+  graph = gt_malloc(sizeof (*graph));
+  graph->vertices = NULL;
+  graph->vertex_states = NULL;
+  graph->edge_offsets = NULL;
+  graph->degrees = NULL;
+  graph->active_degrees = NULL;
+  graph->edges = NULL;
+  graph->edge_info = NULL;
+  graph->edge_states = NULL;
+  graph->names = NULL;
+  graph->names_length = 0;
+  graph->names_size = 0;
+  graph->name_index = NULL;
+  graph->name_index_size = 0;
+  graph->number_index = NULL;
+  graph->number_index_size = 0;
+  graph->number_min = 0;
+  graph->number_prefix_offset = 0;
+  graph->number_prefix_length = 0;
+  graph->mapping = NULL;
+  graph->mapping_size = 0;
+  graph->is_view = false;
+  graph->edge_ids = NULL;
+  memset(graph->vertex_census, 0, sizeof (graph->vertex_census));
+  memset(graph->edge_census, 0, sizeof (graph->edge_census));
+  return graph;
+}
+
+/* Recount the number of vertices and edges of <*graph> in every state */
+static void gt_scaffolder_graph_count_states(GtScaffolderGraph *graph)
+{
+  GtUword vid, eid, first;
+
+  memset(graph->vertex_census, 0, sizeof (graph->vertex_census));
+  memset(graph->edge_census, 0, sizeof (graph->edge_census));
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    graph->vertex_census[graph->vertex_states[vid]]++;
+    first = gt_scaffolder_graph_first_edge(graph, vid);
+    for (eid = first; eid < first + gt_scaffolder_graph_degree(graph, vid);
+         eid++)
+      graph->edge_census[graph->edge_states[eid]]++;
+  }
+}
+
 /* Initialize vertex portion inside <*graph>. Allocate memory for
-   <max_nof_vertices> vertices. */
+   <max_nof_vertices> vertices and their (still empty) edge offsets. */
 static void gt_scaffolder_graph_init_vertices(GtScaffolderGraph *graph,
                                               GtUword max_nof_vertices)
 {
@@ -36,10 +107,42 @@ static void gt_scaffolder_graph_init_vertices(GtScaffolderGraph *graph,
   gt_assert(graph->vertices == NULL);
   gt_assert(max_nof_vertices > 0);
   graph->vertices = gt_malloc(sizeof (*graph->vertices) * max_nof_vertices);
+  graph->vertex_states = gt_malloc(sizeof (*graph->vertex_states) *
+                                   max_nof_vertices);
+  graph->edge_offsets = gt_calloc(max_nof_vertices + 1,
+                                  sizeof (*graph->edge_offsets));
+  graph->degrees = gt_malloc(sizeof (*graph->degrees) * 2 * max_nof_vertices);
+  graph->active_degrees = gt_malloc(sizeof (*graph->active_degrees) * 2 *
+                                    max_nof_vertices);
   graph->nof_vertices = 0;
   graph->max_nof_vertices = max_nof_vertices;
 }
 
+/* Resize vertex portion inside <*graph> to <max_nof_vertices> vertices, which
+   must not be less than the number of vertices in use */
+static void gt_scaffolder_graph_resize_vertices(GtScaffolderGraph *graph,
+                                                GtUword max_nof_vertices)
+{
+  gt_assert(graph != NULL);
+  gt_assert(graph->vertices != NULL);
+  gt_assert(max_nof_vertices >= graph->nof_vertices);
+  gt_assert(max_nof_vertices > 0);
+  graph->vertices = gt_realloc(graph->vertices, sizeof (*graph->vertices) *
+                               max_nof_vertices);
+  graph->vertex_states = gt_realloc(graph->vertex_states,
+                                    sizeof (*graph->vertex_states) *
+                                    max_nof_vertices);
+  graph->edge_offsets = gt_realloc(graph->edge_offsets,
+                                   sizeof (*graph->edge_offsets) *
+                                   (max_nof_vertices + 1));
+  graph->degrees = gt_realloc(graph->degrees, sizeof (*graph->degrees) * 2 *
+                              max_nof_vertices);
+  graph->active_degrees = gt_realloc(graph->active_degrees,
+                                     sizeof (*graph->active_degrees) * 2 *
+                                     max_nof_vertices);
+  graph->max_nof_vertices = max_nof_vertices;
+}
+
 /* Initialize edge portion inside <*graph>. Allocate memory for
    <max_nof_edges> edges. */
 static void gt_scaffolder_graph_init_edges(GtScaffolderGraph *graph,
@@ -48,7 +151,11 @@ static void gt_scaffolder_graph_init_edges(GtScaffolderGraph *graph,
   gt_assert(graph != NULL);
   gt_assert(graph->edges == NULL);
   gt_assert(max_nof_edges > 0);
-  graph->edges = gt_malloc(sizeof (*graph->edges) * max_nof_edges);
+  /* zeroed, as unused slots and padding bytes end up in snapshot files */
+  graph->edges = gt_calloc(max_nof_edges, sizeof (*graph->edges));
+  graph->edge_info = gt_calloc(max_nof_edges, sizeof (*graph->edge_info));
+  graph->edge_states = gt_malloc(sizeof (*graph->edge_states) *
+                                 max_nof_edges);
   graph->nof_edges = 0;
   graph->max_nof_edges = max_nof_edges;
 }
@@ -62,9 +169,7 @@ GtScaffolderGraph *gt_scaffolder_graph_new(GtUword max_nof_vertices,
 {
   GtScaffolderGraph *graph;
 
-  graph = gt_malloc(sizeof (*graph));
-  graph->vertices = NULL;
-  graph->edges = NULL;
+  graph = gt_scaffolder_graph_new_empty();
   gt_scaffolder_graph_init_vertices(graph, max_nof_vertices);
   gt_scaffolder_graph_init_edges(graph, max_nof_edges);
 
@@ -74,43 +179,194 @@ GtScaffolderGraph *gt_scaffolder_graph_new(GtUword max_nof_vertices,
 /* Free all memory allocated for <*graph> including vertices and edges */
 void gt_scaffolder_graph_delete(GtScaffolderGraph *graph)
 {
-  GtScaffolderGraphVertex *vertex;
+  if (graph != NULL && graph->is_view) {
+    gt_free(graph->vertex_states);
+    gt_free(graph->active_degrees);
+    gt_free(graph->edge_states);
+    if (graph->edge_ids != NULL) {
+      gt_free(graph->edge_offsets);
+      gt_free(graph->degrees);
+      gt_free(graph->edges);
+      gt_free(graph->edge_info);
+      gt_free(graph->edge_ids);
+    }
+  }
+  else if (graph != NULL && graph->mapping != NULL)
+    gt_xmunmap(graph->mapping, graph->mapping_size);
+  else if (graph != NULL) {
+    /* delete vertices, their header sequences and edges */
+    gt_free(graph->vertices);
+    gt_free(graph->vertex_states);
+    gt_free(graph->edge_offsets);
+    gt_free(graph->degrees);
+    gt_free(graph->active_degrees);
+    gt_free(graph->edges);
+    gt_free(graph->edge_info);
+    gt_free(graph->edge_states);
+    gt_free(graph->names);
+    gt_free(graph->name_index);
+    gt_free(graph->number_index);
+  }
+
+  gt_free(graph);
+}
+
+/* Create a view of <*graph>, which shares its vertices, edges and names but
+   has its own copy of the vertex and edge states. Views of the same graph
+   can be processed by the algorithms concurrently, <*graph> must neither be
+   changed nor deleted while views exist. */
+GtScaffolderGraph *gt_scaffolder_graph_new_view(const GtScaffolderGraph *graph)
+{
+  GtScaffolderGraph *view;
 
-  if (graph != NULL) {
+  gt_assert(graph != NULL);
+
+  view = gt_malloc(sizeof (*view));
+  *view = *graph;
+  view->is_view = true;
+  /* the adjacency of a compacted graph stays with it */
+  view->edge_ids = NULL;
+  view->vertex_states = gt_malloc(sizeof (*view->vertex_states) *
+                                  graph->nof_vertices);
+  memcpy(view->vertex_states, graph->vertex_states,
+         sizeof (*view->vertex_states) * graph->nof_vertices);
+  view->active_degrees = gt_malloc(sizeof (*view->active_degrees) * 2 *
+                                   graph->nof_vertices);
+  memcpy(view->active_degrees, graph->active_degrees,
+         sizeof (*view->active_degrees) * 2 * graph->nof_vertices);
+  view->edge_states = gt_malloc(sizeof (*view->edge_states) *
+                                graph->max_nof_edges);
+  memcpy(view->edge_states, graph->edge_states,
+         sizeof (*view->edge_states) * graph->max_nof_edges);
+
+  return view;
+}
+
+/* returns true if edge <edge> of <*graph> connects unmarked vertices and
+   it or its twin is unmarked, all other edges are skipped by the
+   traversals and no longer change */
+static bool gt_scaffolder_graph_edge_is_live(const GtScaffolderGraph *graph,
+                                             GtUword edge)
+{
+  GtUword twin;
+
+  if ((GIS_MASK(graph->vertex_states[gt_scaffolder_graph_edge_start(graph,
+        edge)]) & GIS_VERTEX_MARKED) != 0 ||
+      (GIS_MASK(graph->vertex_states[graph->edges[edge].end]) &
+       GIS_VERTEX_MARKED) != 0)
+    return false;
+  if ((GIS_MASK(graph->edge_states[edge]) & GIS_EDGE_MARKED) == 0)
+    return true;
+  twin = gt_scaffolder_graph_edge_twin(graph, edge);
+  return twin != GT_UNDEF_UWORD &&
+         (GIS_MASK(graph->edge_states[twin]) & GIS_EDGE_MARKED) == 0;
+}
 
-    /* Iterate over vertices and free header_seq and pointer to outgoing edges
-       first */
-    if (graph->vertices != NULL) {
-      for ( vertex = graph->vertices;
-            vertex < (graph->vertices + graph->nof_vertices);
-            vertex++
-          )
-      {
-        gt_str_delete(vertex->header_seq);
-        gt_free(vertex->edges);
+/* Create a compacted view of <*graph>, which only holds the live edges */
+GtScaffolderGraph *
+gt_scaffolder_graph_new_compacted(const GtScaffolderGraph *graph)
+{
+  GtScaffolderGraph *view;
+  GtUword *new_edge_ids, vid, eid, new_eid, first;
+
+  gt_assert(graph != NULL);
+
+  view = gt_scaffolder_graph_new_view(graph);
+
+  /* number the live edges in the order of the adjacency */
+  new_edge_ids = gt_malloc(sizeof (*new_edge_ids) * graph->max_nof_edges);
+  view->edge_offsets = gt_malloc(sizeof (*view->edge_offsets) *
+                                 (graph->nof_vertices + 1));
+  view->degrees = gt_malloc(sizeof (*view->degrees) * 2 *
+                            graph->nof_vertices);
+  view->edge_offsets[0] = 0;
+  new_eid = 0;
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    view->degrees[2 * vid] = view->degrees[2 * vid + 1] = 0;
+    first = gt_scaffolder_graph_first_edge(graph, vid);
+    for (eid = first; eid < first + gt_scaffolder_graph_degree(graph, vid);
+         eid++) {
+      if (gt_scaffolder_graph_edge_is_live(graph, eid)) {
+        new_edge_ids[eid] = new_eid++;
+        gt_scaffolder_graph_degree_in_dir(view, vid,
+          gt_scaffolder_graph_edge_sense(graph->edges + eid))++;
       }
     }
+    view->edge_offsets[vid + 1] = new_eid;
+  }
 
-    /* Now delete vertices and edges*/
-    gt_free(graph->vertices);
-    gt_free(graph->edges);
+  /* copy the live edges, twins of live edges are live as well */
+  view->nof_edges = new_eid;
+  view->max_nof_edges = MAX(new_eid, 1);
+  view->edges = gt_calloc(view->max_nof_edges, sizeof (*view->edges));
+  view->edge_info = gt_calloc(view->max_nof_edges, sizeof (*view->edge_info));
+  gt_free(view->edge_states);
+  view->edge_states = gt_malloc(sizeof (*view->edge_states) *
+                                view->max_nof_edges);
+  view->edge_ids = gt_malloc(sizeof (*view->edge_ids) * view->max_nof_edges);
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    first = gt_scaffolder_graph_first_edge(graph, vid);
+    for (eid = first; eid < first + gt_scaffolder_graph_degree(graph, vid);
+         eid++) {
+      if (!gt_scaffolder_graph_edge_is_live(graph, eid))
+        continue;
+      new_eid = new_edge_ids[eid];
+      view->edges[new_eid] = graph->edges[eid];
+      view->edge_info[new_eid] = graph->edge_info[eid];
+      if (graph->edge_info[eid].twin != GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+        view->edge_info[new_eid].twin =
+          new_edge_ids[graph->edge_info[eid].twin];
+      view->edge_states[new_eid] = graph->edge_states[eid];
+      view->edge_ids[new_eid] = eid;
+    }
   }
+  gt_scaffolder_graph_count_states(view);
 
-  gt_free(graph);
+  gt_free(new_edge_ids);
+
+  return view;
+}
+
+/* Append header sequence <*name> of length <len> to the name pool of
+   <*graph>, returns its offset */
+static GtUword gt_scaffolder_graph_add_name(GtScaffolderGraph *graph,
+                                            const char *name,
+                                            GtUword len)
+{
+  GtUword offset;
+
+  if (graph->names_length + len + 1 > graph->names_size) {
+    graph->names_size = MAX(2 * graph->names_size,
+                            graph->names_length + len + 1);
+    graph->names = gt_realloc(graph->names,
+                              sizeof (*graph->names) * graph->names_size);
+  }
+  offset = graph->names_length;
+  if (len > 0)
+    memcpy(graph->names + offset, name, len);
+  graph->names[offset + len] = '\0';
+  graph->names_length += len + 1;
+
+  return offset;
 }
 
 /* Initialize a new vertex in <*graph>. Each vertex represents a contig and
-   contains information about the sequence header <*header_seq>, sequence
-   length <seq_len>, A-statistics <astat> and estimated copy number <copy_num>*/
+   contains information about the sequence header <*header_seq> of length
+   <header_len>, which is copied into the name pool, sequence length <seq_len>,
+   number <seqnum> of the contig in the FASTA file, A-statistics <astat> and
+   estimated copy number <copy_num>*/
 void gt_scaffolder_graph_add_vertex(GtScaffolderGraph *graph,
-                                    GtStr *header_seq,
+                                    const char *header_seq,
+                                    GtUword header_len,
                                     GtUword seq_len,
+                                    GtUword seqnum,
                                     float astat,
                                     float copy_num)
 {
   GtUword nextfree;
 
   gt_assert(graph != NULL);
+  gt_assert(graph->mapping == NULL && !graph->is_view);
   gt_assert(graph->vertices != NULL);
   gt_assert(graph->nof_vertices < graph->max_nof_vertices);
 
@@ -118,129 +374,1292 @@ void gt_scaffolder_graph_add_vertex(GtScaffolderGraph *graph,
 
   /* Initialize vertex */
   graph->vertices[nextfree].seq_len = seq_len;
+  graph->vertices[nextfree].seqnum = seqnum;
   graph->vertices[nextfree].astat = astat;
   graph->vertices[nextfree].copy_num = copy_num;
-  graph->vertices[nextfree].nof_edges = 0;
-  if (header_seq != NULL) {
-    graph->vertices[nextfree].header_seq = header_seq;
-  }
-  graph->vertices[nextfree].state = GIS_UNVISITED;
-  graph->vertices[nextfree].edges = NULL;
+  if (header_seq == NULL)
+    header_len = 0;
+  graph->vertices[nextfree].name_offset =
+    gt_scaffolder_graph_add_name(graph, header_seq, header_len);
+  graph->vertices[nextfree].name_length = header_len;
+  graph->vertex_states[nextfree] = GIS_UNVISITED;
+  graph->vertex_census[GIS_UNVISITED]++;
+  graph->degrees[2 * nextfree] = 0;
+  graph->degrees[2 * nextfree + 1] = 0;
+  graph->active_degrees[2 * nextfree] = 0;
+  graph->active_degrees[2 * nextfree + 1] = 0;
 
   graph->nof_vertices++;
 }
 
+/* Move edge <from> to slot <to> within the edge range of its start vertex,
+   the edges in between shift by one slot towards <from>. Twin links of the
+   shifted edges and their twins are renumbered accordingly. */
+static void gt_scaffolder_graph_move_edge(GtScaffolderGraph *graph,
+                                          GtUword from,
+                                          GtUword to)
+{
+  GtScaffolderGraphEdge edge;
+  GtScaffolderGraphEdgeInfo info;
+  GtUchar state;
+  GtUword low, high, eid, twin;
+
+  gt_assert(graph != NULL);
+  gt_assert(graph->edge_info[from].start == graph->edge_info[to].start);
+
+  if (from == to)
+    return;
+  edge = graph->edges[from];
+  info = graph->edge_info[from];
+  state = graph->edge_states[from];
+  if (from > to) {
+    memmove(graph->edges + to + 1, graph->edges + to,
+            sizeof (*graph->edges) * (from - to));
+    memmove(graph->edge_info + to + 1, graph->edge_info + to,
+            sizeof (*graph->edge_info) * (from - to));
+    memmove(graph->edge_states + to + 1, graph->edge_states + to,
+            sizeof (*graph->edge_states) * (from - to));
+    low = to;
+    high = from;
+  }
+  else {
+    memmove(graph->edges + from, graph->edges + from + 1,
+            sizeof (*graph->edges) * (to - from));
+    memmove(graph->edge_info + from, graph->edge_info + from + 1,
+            sizeof (*graph->edge_info) * (to - from));
+    memmove(graph->edge_states + from, graph->edge_states + from + 1,
+            sizeof (*graph->edge_states) * (to - from));
+    low = from;
+    high = to;
+  }
+  graph->edges[to] = edge;
+  graph->edge_info[to] = info;
+  graph->edge_states[to] = state;
+
+  /* all edges of one vertex lead to other vertices or loop back to the same
+     one, so the twin of a moved edge is either outside [low, high] or moved
+     itself */
+  for (eid = low; eid <= high; eid++) {
+    twin = graph->edge_info[eid].twin;
+    if (twin == GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+      continue;
+    if (twin == from)
+      twin = to;
+    else if (twin >= low && twin <= high)
+      twin = from > to ? twin + 1 : twin - 1;
+    else
+      graph->edge_info[twin].twin = eid;
+    graph->edge_info[eid].twin = twin;
+  }
+}
+
 /* Initialize a new edge in <*graph>. Each edge between two contig
    vertices <vstartID> and <vendID> contains information about the distance
    <dist>, standard deviation <std_dev>, number of pairs <num_pairs> and the
-   direction of <vstartID> <dir> and corresponding <vendID> <same> */
-void gt_scaffolder_graph_add_edge(GtScaffolderGraph *graph,
-                                  GtScaffolderGraphVertex *vstart,
-                                  GtScaffolderGraphVertex *vend,
-                                  GtWord dist,
-                                  float std_dev,
-                                  GtUword num_pairs,
-                                  bool dir,
-                                  bool same)
-{
-  GtUword nextfree = graph->nof_edges;
+   direction of <vstartID> <dir> and corresponding <vendID> <same>.
+   Returns the id of the new edge. A new antisense edge is inserted in front
+   of the sense edges of <vstartID>, which move by one slot. */
+GtUword gt_scaffolder_graph_add_edge(GtScaffolderGraph *graph,
+                                     GtUword vstart,
+                                     GtUword vend,
+                                     GtWord dist,
+                                     float std_dev,
+                                     GtUword num_pairs,
+                                     bool dir,
+                                     bool same)
+{
+  GtUword nextfree;
 
   gt_assert(graph != NULL);
+  gt_assert(graph->mapping == NULL && !graph->is_view);
   gt_assert(graph->vertices != NULL);
-  gt_assert(vstart != NULL);
+  gt_assert(vstart < graph->nof_vertices);
+  gt_assert(vend < graph->nof_vertices);
   gt_assert(graph->edges != NULL);
   gt_assert(graph->nof_edges < graph->max_nof_edges);
 
+  /* next free slot in the edge range of the start vertex */
+  nextfree = graph->edge_offsets[vstart] +
+             gt_scaffolder_graph_degree(graph, vstart);
+  gt_assert(nextfree < graph->edge_offsets[vstart + 1]);
+
   /* Inititalize edge */
-  graph->edges[nextfree].start = vstart;
   graph->edges[nextfree].end = vend;
-  graph->edges[nextfree].dist = dist;
-  graph->edges[nextfree].std_dev = std_dev;
-  graph->edges[nextfree].num_pairs = num_pairs;
-  graph->edges[nextfree].sense = dir;
-  graph->edges[nextfree].same = same;
-  graph->edges[nextfree].state = GIS_UNVISITED;
-
-  /* Add ptr to edge to start vertex */
-  gt_assert(vstart != NULL);
-  vstart->edges[vstart->nof_edges] = graph->edges + nextfree;
-  vstart->nof_edges++;
+  graph->edges[nextfree].dist = gt_scaffolder_graph_saturate_dist(dist);
+  graph->edges[nextfree].flags = (dir ? GT_SCAFFOLDER_GRAPH_SENSE : 0) |
+                                 (same ? GT_SCAFFOLDER_GRAPH_SAME : 0);
+  graph->edge_info[nextfree].start = vstart;
+  graph->edge_info[nextfree].twin = GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+  graph->edge_info[nextfree].std_dev = std_dev;
+  graph->edge_info[nextfree].num_pairs =
+    gt_scaffolder_graph_saturate_count(num_pairs);
+  graph->edge_states[nextfree] = GIS_UNVISITED;
+  graph->edge_census[GIS_UNVISITED]++;
+
+  /* antisense edges precede the sense edges of a vertex */
+  if (!dir && gt_scaffolder_graph_degree_in_dir(graph, vstart, true) > 0) {
+    gt_scaffolder_graph_move_edge(graph, nextfree,
+      gt_scaffolder_graph_first_edge_in_dir(graph, vstart, true));
+    nextfree = gt_scaffolder_graph_first_edge_in_dir(graph, vstart, true);
+  }
 
+  gt_scaffolder_graph_degree_in_dir(graph, vstart, dir)++;
+  gt_scaffolder_graph_active_degree(graph, vstart, dir)++;
   graph->nof_edges++;
+
+  return nextfree;
+}
+
+/* Link edges <edge_1> and <edge_2>, which connect the same vertices in
+   opposite directions, as twins of each other */
+void gt_scaffolder_graph_link_twins(GtScaffolderGraph *graph,
+                                    GtUword edge_1,
+                                    GtUword edge_2)
+{
+  gt_assert(graph != NULL);
+  gt_assert(graph->edge_info[edge_1].start == graph->edges[edge_2].end &&
+            graph->edges[edge_1].end == graph->edge_info[edge_2].start);
+
+  graph->edge_info[edge_1].twin = edge_2;
+  graph->edge_info[edge_2].twin = edge_1;
 }
 
-/* Returns pointer to edge between <*vertex1> and <*vertex2> */
-GtScaffolderGraphEdge
-*gt_scaffolder_graph_find_edge(const GtScaffolderGraphVertex *vertex_1,
-                               const GtScaffolderGraphVertex *vertex_2)
+/* Reserve the edge portion of <*graph> in compressed sparse row layout. The
+   vertex with id i gets <degrees[i]> consecutive slots for outgoing edges. */
+void gt_scaffolder_graph_init_adjacency(GtScaffolderGraph *graph,
+                                        const GtUword *degrees)
 {
-  GtUword eid;
+  GtUword vid;
 
-  for (eid = 0; eid < vertex_1->nof_edges; eid++) {
-    if (vertex_1->edges[eid]->end == vertex_2)
-      return vertex_1->edges[eid];
+  gt_assert(graph != NULL);
+  gt_assert(graph->edge_offsets != NULL);
+  gt_assert(degrees != NULL);
+
+  /* prefix sums over the degrees yield the start of every edge range */
+  graph->edge_offsets[0] = 0;
+  for (vid = 0; vid < graph->nof_vertices; vid++)
+    graph->edge_offsets[vid + 1] = graph->edge_offsets[vid] + degrees[vid];
+
+  gt_scaffolder_graph_init_edges(graph, graph->edge_offsets[vid]);
+}
+
+/* Returns id of edge from <vertex_1> to <vertex_2>, GT_UNDEF_UWORD if there
+   is none */
+GtUword gt_scaffolder_graph_find_edge(const GtScaffolderGraph *graph,
+                                      GtUword vertex_1,
+                                      GtUword vertex_2)
+{
+  GtUword eid, first;
+
+  first = gt_scaffolder_graph_first_edge(graph, vertex_1);
+  for (eid = first;
+       eid < first + gt_scaffolder_graph_degree(graph, vertex_1); eid++) {
+    if (graph->edges[eid].end == vertex_2)
+      return eid;
+  }
+  return GT_UNDEF_UWORD;
+}
+
+/* FNV-1a hash of contig header <name> with length <len> */
+static GtUword gt_scaffolder_graph_hash_name(const char *name, GtUword len)
+{
+  GtUword i, hash = 2166136261UL;
+
+  for (i = 0; i < len; i++) {
+    hash ^= (GtUchar) name[i];
+    hash *= 16777619UL;
   }
-  return NULL;
+  return hash;
 }
 
-/* determines corresponding vertex to contig header */
+/* checks if vertex <vid> of <*graph> has header sequence <*name> of length
+   <len> */
+static bool gt_scaffolder_graph_name_equals(const GtScaffolderGraph *graph,
+                                            GtUword vid,
+                                            const char *name,
+                                            GtUword len)
+{
+  return graph->vertices[vid].name_length == len &&
+         memcmp(gt_scaffolder_graph_vertex_name(graph, vid), name, len) == 0;
+}
+
+/* checks if contig header <*name> of length <len> consists of the number
+   prefix of <*graph> followed by a decimal number without leading zeros,
+   which is stored in <*number> */
+static bool gt_scaffolder_graph_name_number(const GtScaffolderGraph *graph,
+                                            const char *name,
+                                            GtUword len,
+                                            GtUword *number)
+{
+  GtUword i, prefix_length = graph->number_prefix_length;
+
+  if (len <= prefix_length ||
+      len - prefix_length > GT_SCAFFOLDER_GRAPH_MAX_NUMBER_DIGITS ||
+      (name[prefix_length] == '0' && len - prefix_length > 1) ||
+      memcmp(name, graph->names + graph->number_prefix_offset,
+             prefix_length) != 0)
+    return false;
+  *number = 0;
+  for (i = prefix_length; i < len; i++) {
+    if (name[i] < '0' || name[i] > '9')
+      return false;
+    *number = 10 * *number + (name[i] - '0');
+  }
+  return true;
+}
+
+/* Build the table from number to vertex if the headers of <*graph> are
+   numbered densely. The prefix is taken from the first vertex, its header
+   without the trailing digits. */
+static void gt_scaffolder_graph_index_numbers(GtScaffolderGraph *graph)
+{
+  GtUword vid, len, number, number_max = 0, nof_numbered = 0;
+  const char *name;
+
+  name = gt_scaffolder_graph_vertex_name(graph, 0);
+  len = graph->vertices[0].name_length;
+  while (len > 0 && name[len - 1] >= '0' && name[len - 1] <= '9')
+    len--;
+  graph->number_prefix_offset = graph->vertices[0].name_offset;
+  graph->number_prefix_length = len;
+  graph->number_min = GT_UWORD_MAX;
+
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    if (gt_scaffolder_graph_name_number(graph,
+                                        gt_scaffolder_graph_vertex_name(graph,
+                                                                        vid),
+                                        graph->vertices[vid].name_length,
+                                        &number)) {
+      graph->number_min = MIN(graph->number_min, number);
+      number_max = MAX(number_max, number);
+      nof_numbered++;
+    }
+  }
+
+  if (nof_numbered == 0 ||
+      number_max - graph->number_min >=
+      GT_SCAFFOLDER_GRAPH_NUMBER_INDEX_FACTOR * graph->nof_vertices) {
+    graph->number_min = 0;
+    graph->number_prefix_length = 0;
+    return;
+  }
+
+  graph->number_index_size = number_max - graph->number_min + 1;
+  graph->number_index = gt_malloc(sizeof (*graph->number_index) *
+                                  graph->number_index_size);
+  for (number = 0; number < graph->number_index_size; number++)
+    graph->number_index[number] = GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    /* the first of several equal headers wins like in the hash index */
+    if (gt_scaffolder_graph_name_number(graph,
+                                        gt_scaffolder_graph_vertex_name(graph,
+                                                                        vid),
+                                        graph->vertices[vid].name_length,
+                                        &number) &&
+        graph->number_index[number - graph->number_min] ==
+        GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+      graph->number_index[number - graph->number_min] = vid;
+  }
+}
+
+/* Build the hash index from contig header to vertex for all vertices of
+   <*graph>. If the headers share a prefix followed by densely used numbers,
+   a table from number to vertex is built as well, which lets
+   gt_scaffolder_graph_get_vertex skip hashing for these headers. Has to be
+   called once after all vertices are added. */
+void gt_scaffolder_graph_index_vertices(GtScaffolderGraph *graph)
+{
+  GtUword vid, slot, mask, len;
+  const char *name;
+
+  gt_assert(graph != NULL);
+  gt_assert(graph->name_index == NULL);
+
+  /* keep load factor at most 0.5 */
+  graph->name_index_size = 2;
+  while (graph->name_index_size < 2 * graph->nof_vertices)
+    graph->name_index_size *= 2;
+  mask = graph->name_index_size - 1;
+
+  graph->name_index = gt_malloc(sizeof (*graph->name_index) *
+                                graph->name_index_size);
+  for (slot = 0; slot < graph->name_index_size; slot++)
+    graph->name_index[slot] = GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    name = gt_scaffolder_graph_vertex_name(graph, vid);
+    len = graph->vertices[vid].name_length;
+    slot = gt_scaffolder_graph_hash_name(name, len) & mask;
+    /* linear probing, the first of several equal headers wins */
+    while (graph->name_index[slot] != GT_SCAFFOLDER_GRAPH_UNDEF_ID &&
+           !gt_scaffolder_graph_name_equals(graph, graph->name_index[slot],
+                                            name, len))
+      slot = (slot + 1) & mask;
+    if (graph->name_index[slot] == GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+      graph->name_index[slot] = vid;
+  }
+
+  if (graph->nof_vertices > 0)
+    gt_scaffolder_graph_index_numbers(graph);
+}
+
+/* determines id <*vertex> of the vertex corresponding to contig header
+   <*header_seq> of length <header_len> using the number table for regularly
+   numbered headers and the hash index otherwise, returns false if no vertex
+   belongs to <header_seq> */
 bool gt_scaffolder_graph_get_vertex(const GtScaffolderGraph *graph,
-                                    GtScaffolderGraphVertex **vertex,
-                                    const GtStr *header_seq)
-{
-  GtScaffolderGraphVertex *min_vertex, *max_vertex, *mid_vertex;
-  int cmp;
-  bool found;
-
-  found = false;
-  /* binary search */
-  min_vertex = graph->vertices;
-  max_vertex = graph->vertices + graph->nof_vertices - 1;
-  while (max_vertex >= min_vertex)
-    {
-      /* calculate midpoint */
-      mid_vertex = min_vertex + ((max_vertex - min_vertex) / 2);
-      cmp = gt_str_cmp(mid_vertex->header_seq, header_seq);
-      if (cmp == 0)
-      {
-        found = true;
-        *vertex = mid_vertex;
-        break;
+                                    GtUword *vertex,
+                                    const char *header_seq,
+                                    GtUword header_len)
+{
+  GtUword slot, mask, number;
+
+  gt_assert(graph != NULL);
+  gt_assert(graph->name_index != NULL);
+
+  /* headers of the numbered form can only belong to a numbered vertex, so
+     the table decides on its own */
+  if (graph->number_index != NULL &&
+      gt_scaffolder_graph_name_number(graph, header_seq, header_len,
+                                      &number)) {
+    if (number < graph->number_min ||
+        number - graph->number_min >= graph->number_index_size ||
+        graph->number_index[number - graph->number_min] ==
+        GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+      return false;
+    *vertex = graph->number_index[number - graph->number_min];
+    return true;
+  }
+
+  mask = graph->name_index_size - 1;
+  slot = gt_scaffolder_graph_hash_name(header_seq, header_len) & mask;
+  while (graph->name_index[slot] != GT_SCAFFOLDER_GRAPH_UNDEF_ID) {
+    if (gt_scaffolder_graph_name_equals(graph, graph->name_index[slot],
+                                        header_seq, header_len)) {
+      *vertex = graph->name_index[slot];
+      return true;
+    }
+    slot = (slot + 1) & mask;
+  }
+  return false;
+}
+
+/* Renumber the vertices of <*graph> in breadth first order of its connected
+   components, which are visited in the order of their smallest vertex id.
+   The edges are rearranged accordingly, so that adjacent vertices and their
+   edges are close to each other in memory. All vertex and edge ids change,
+   lookups by contig header keep working. */
+void gt_scaffolder_graph_renumber_vertices(GtScaffolderGraph *graph)
+{
+  GtScaffolderGraphVertex *vertices;
+  GtScaffolderGraphEdge *edges;
+  GtScaffolderGraphEdgeInfo *edge_info;
+  GtScaffolderGraphId *edge_offsets, *degrees, *active_degrees;
+  GtUchar *vertex_states, *edge_states;
+  GtUword *order, *new_vertex_ids, *new_edge_ids, qhead, qtail, root, vid,
+          new_vid, eid, new_eid, first, slot;
+
+  gt_assert(graph != NULL);
+  gt_assert(graph->mapping == NULL && !graph->is_view);
+  gt_assert(graph->edges != NULL);
+
+  /* breadth first search from every unvisited vertex in order of ids, the
+     queue of the search is the resulting order of the vertices */
+  order = gt_malloc(sizeof (*order) * graph->nof_vertices);
+  new_vertex_ids = gt_malloc(sizeof (*new_vertex_ids) * graph->nof_vertices);
+  for (vid = 0; vid < graph->nof_vertices; vid++)
+    new_vertex_ids[vid] = GT_UNDEF_UWORD;
+  qtail = 0;
+  for (root = 0; root < graph->nof_vertices; root++) {
+    if (new_vertex_ids[root] != GT_UNDEF_UWORD)
+      continue;
+    new_vertex_ids[root] = qtail;
+    order[qtail++] = root;
+    for (qhead = new_vertex_ids[root]; qhead < qtail; qhead++) {
+      first = gt_scaffolder_graph_first_edge(graph, order[qhead]);
+      for (eid = first;
+           eid < first + gt_scaffolder_graph_degree(graph, order[qhead]);
+           eid++) {
+        vid = graph->edges[eid].end;
+        if (new_vertex_ids[vid] == GT_UNDEF_UWORD) {
+          new_vertex_ids[vid] = qtail;
+          order[qtail++] = vid;
+        }
       }
-      else if (cmp < 0)
-        min_vertex = mid_vertex + 1;
-      else
-        max_vertex = mid_vertex - 1;
     }
-  return found;
+  }
+  gt_assert(qtail == graph->nof_vertices);
+
+  /* edge ranges keep their capacity and follow the new vertex order */
+  vertices = gt_malloc(sizeof (*vertices) * graph->max_nof_vertices);
+  vertex_states = gt_malloc(sizeof (*vertex_states) *
+                            graph->max_nof_vertices);
+  edge_offsets = gt_calloc(graph->max_nof_vertices + 1,
+                           sizeof (*edge_offsets));
+  degrees = gt_malloc(sizeof (*degrees) * 2 * graph->max_nof_vertices);
+  active_degrees = gt_malloc(sizeof (*active_degrees) * 2 *
+                             graph->max_nof_vertices);
+  new_edge_ids = gt_malloc(sizeof (*new_edge_ids) * graph->max_nof_edges);
+  for (new_vid = 0; new_vid < graph->nof_vertices; new_vid++) {
+    vid = order[new_vid];
+    vertices[new_vid] = graph->vertices[vid];
+    vertex_states[new_vid] = graph->vertex_states[vid];
+    degrees[2 * new_vid] = graph->degrees[2 * vid];
+    degrees[2 * new_vid + 1] = graph->degrees[2 * vid + 1];
+    active_degrees[2 * new_vid] = graph->active_degrees[2 * vid];
+    active_degrees[2 * new_vid + 1] = graph->active_degrees[2 * vid + 1];
+    edge_offsets[new_vid + 1] = edge_offsets[new_vid] +
+                                (graph->edge_offsets[vid + 1] -
+                                 graph->edge_offsets[vid]);
+    first = gt_scaffolder_graph_first_edge(graph, vid);
+    for (eid = first; eid < first + gt_scaffolder_graph_degree(graph, vid);
+         eid++)
+      new_edge_ids[eid] = edge_offsets[new_vid] + (eid - first);
+  }
+
+  edges = gt_calloc(graph->max_nof_edges, sizeof (*edges));
+  edge_info = gt_calloc(graph->max_nof_edges, sizeof (*edge_info));
+  edge_states = gt_malloc(sizeof (*edge_states) * graph->max_nof_edges);
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    first = gt_scaffolder_graph_first_edge(graph, vid);
+    for (eid = first; eid < first + gt_scaffolder_graph_degree(graph, vid);
+         eid++) {
+      new_eid = new_edge_ids[eid];
+      edges[new_eid] = graph->edges[eid];
+      edges[new_eid].end = new_vertex_ids[graph->edges[eid].end];
+      edge_info[new_eid] = graph->edge_info[eid];
+      edge_info[new_eid].start = new_vertex_ids[vid];
+      if (graph->edge_info[eid].twin != GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+        edge_info[new_eid].twin = new_edge_ids[graph->edge_info[eid].twin];
+      edge_states[new_eid] = graph->edge_states[eid];
+    }
+  }
+
+  /* the slots of the name index only depend on the contig headers */
+  if (graph->name_index != NULL) {
+    for (slot = 0; slot < graph->name_index_size; slot++) {
+      if (graph->name_index[slot] != GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+        graph->name_index[slot] = new_vertex_ids[graph->name_index[slot]];
+    }
+  }
+  if (graph->number_index != NULL) {
+    for (slot = 0; slot < graph->number_index_size; slot++) {
+      if (graph->number_index[slot] != GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+        graph->number_index[slot] =
+          new_vertex_ids[graph->number_index[slot]];
+    }
+  }
+
+  gt_free(graph->vertices);
+  gt_free(graph->vertex_states);
+  gt_free(graph->edge_offsets);
+  gt_free(graph->degrees);
+  gt_free(graph->active_degrees);
+  gt_free(graph->edges);
+  gt_free(graph->edge_info);
+  gt_free(graph->edge_states);
+  graph->vertices = vertices;
+  graph->vertex_states = vertex_states;
+  graph->edge_offsets = edge_offsets;
+  graph->degrees = degrees;
+  graph->active_degrees = active_degrees;
+  graph->edges = edges;
+  graph->edge_info = edge_info;
+  graph->edge_states = edge_states;
+
+  gt_free(order);
+  gt_free(new_vertex_ids);
+  gt_free(new_edge_ids);
+}
+
+/* set state of edge <edge> in <*graph> to <state> and update the number of
+   unmarked edges of its start vertex */
+void gt_scaffolder_graph_set_edge_state(GtScaffolderGraph *graph,
+                                        GtUword edge,
+                                        GraphItemState state)
+{
+  bool was_marked, is_marked;
+  GtUword start;
+
+  gt_assert(graph != NULL);
+  gt_assert(edge < graph->max_nof_edges);
+
+  was_marked = (GIS_MASK(graph->edge_states[edge]) & GIS_EDGE_MARKED) != 0;
+  is_marked = (GIS_MASK(state) & GIS_EDGE_MARKED) != 0;
+  if (was_marked != is_marked) {
+    start = gt_scaffolder_graph_edge_start(graph, edge);
+    if (is_marked)
+      gt_scaffolder_graph_active_degree(graph, start,
+        gt_scaffolder_graph_edge_sense(graph->edges + edge))--;
+    else
+      gt_scaffolder_graph_active_degree(graph, start,
+        gt_scaffolder_graph_edge_sense(graph->edges + edge))++;
+  }
+  graph->edge_census[graph->edge_states[edge]]--;
+  graph->edge_census[state]++;
+  graph->edge_states[edge] = state;
+}
+
+/* set state of vertex <vertex> in <*graph> to <state> and update the number
+   of vertices per state */
+void gt_scaffolder_graph_set_vertex_state(GtScaffolderGraph *graph,
+                                          GtUword vertex,
+                                          GraphItemState state)
+{
+  gt_assert(graph != NULL);
+  gt_assert(vertex < graph->nof_vertices);
+
+  graph->vertex_census[graph->vertex_states[vertex]]--;
+  graph->vertex_census[state]++;
+  graph->vertex_states[vertex] = state;
+}
+
+/* Capture the states of all vertices and edges of <*graph>, the topology is
+   not copied */
+GtScaffolderGraphStates *
+gt_scaffolder_graph_states_new(const GtScaffolderGraph *graph)
+{
+  GtScaffolderGraphStates *states;
+  size_t active_size;
+
+  gt_assert(graph != NULL);
+
+  /* the counters come first in the buffer to keep them aligned */
+  active_size = sizeof (*states->active_degrees) * 2 * graph->nof_vertices;
+  states = gt_malloc(sizeof (*states));
+  states->nof_vertices = graph->nof_vertices;
+  states->max_nof_edges = graph->max_nof_edges;
+  states->active_degrees = gt_malloc(active_size + graph->nof_vertices +
+                                     graph->max_nof_edges);
+  states->vertex_states = (GtUchar *) states->active_degrees + active_size;
+  states->edge_states = states->vertex_states + graph->nof_vertices;
+
+  memcpy(states->active_degrees, graph->active_degrees, active_size);
+  memcpy(states->vertex_states, graph->vertex_states, graph->nof_vertices);
+  memcpy(states->edge_states, graph->edge_states, graph->max_nof_edges);
+  memcpy(states->vertex_census, graph->vertex_census,
+         sizeof (states->vertex_census));
+  memcpy(states->edge_census, graph->edge_census,
+         sizeof (states->edge_census));
+
+  return states;
+}
+
+/* Overwrite the states of all vertices and edges of <*graph> with <*states>,
+   which were captured from the same graph */
+void gt_scaffolder_graph_states_restore(GtScaffolderGraph *graph,
+                                        const GtScaffolderGraphStates *states)
+{
+  gt_assert(graph != NULL);
+  gt_assert(states != NULL);
+  gt_assert(states->nof_vertices == graph->nof_vertices);
+  gt_assert(states->max_nof_edges == graph->max_nof_edges);
+
+  memcpy(graph->active_degrees, states->active_degrees,
+         sizeof (*graph->active_degrees) * 2 * graph->nof_vertices);
+  memcpy(graph->vertex_states, states->vertex_states, graph->nof_vertices);
+  memcpy(graph->edge_states, states->edge_states, graph->max_nof_edges);
+  memcpy(graph->vertex_census, states->vertex_census,
+         sizeof (graph->vertex_census));
+  memcpy(graph->edge_census, states->edge_census,
+         sizeof (graph->edge_census));
+}
+
+/* Free all memory allocated for <*states> */
+void gt_scaffolder_graph_states_delete(GtScaffolderGraphStates *states)
+{
+  if (states != NULL)
+    gt_free(states->active_degrees);
+  gt_free(states);
+}
+
+/* store the memory of graph arrays for <max_nof_vertices> vertices,
+   <max_nof_edges> edges, a name pool of <names_size> bytes, a name index
+   with <name_index_size> slots and a number index with <number_index_size>
+   slots in <*memory> */
+static void gt_scaffolder_graph_memory_of(GtUword max_nof_vertices,
+                                          GtUword max_nof_edges,
+                                          GtUword names_size,
+                                          GtUword name_index_size,
+                                          GtUword number_index_size,
+                                          GtScaffolderGraphMemory *memory)
+{
+  const GtScaffolderGraph *graph = NULL;
+
+  memory->vertices = max_nof_vertices * (sizeof (*graph->vertices) +
+                                         sizeof (*graph->vertex_states) +
+                                         2 * sizeof (*graph->active_degrees));
+  memory->adjacency = (max_nof_vertices + 1) * sizeof (*graph->edge_offsets) +
+                      2 * max_nof_vertices * sizeof (*graph->degrees);
+  memory->edges = max_nof_edges * (sizeof (*graph->edges) +
+                                   sizeof (*graph->edge_info) +
+                                   sizeof (*graph->edge_states));
+  memory->names = names_size * sizeof (*graph->names) +
+                  name_index_size * sizeof (*graph->name_index) +
+                  number_index_size * sizeof (*graph->number_index);
+  memory->total = memory->vertices + memory->adjacency + memory->edges +
+                  memory->names;
+}
+
+/* Store the memory allocated for the arrays of <*graph> in <*memory> */
+void gt_scaffolder_graph_memory(const GtScaffolderGraph *graph,
+                                GtScaffolderGraphMemory *memory)
+{
+  gt_assert(graph != NULL);
+  gt_assert(memory != NULL);
+
+  gt_scaffolder_graph_memory_of(graph->max_nof_vertices,
+                                graph->edges != NULL ? graph->max_nof_edges : 0,
+                                graph->names_size,
+                                graph->name_index != NULL ?
+                                graph->name_index_size : 0,
+                                graph->number_index != NULL ?
+                                graph->number_index_size : 0,
+                                memory);
+}
+
+/* Estimate the memory of a graph before it is built, returns the peak memory
+   of gt_scaffolder_graph_new_from_file */
+GtUword gt_scaffolder_graph_estimate_memory(GtUword nof_vertices,
+                                            GtUword nof_edges,
+                                            GtUword names_length,
+                                            GtUword records_size,
+                                            GtScaffolderGraphMemory *memory)
+{
+  const GtScaffolderGraphBuilder *builder = NULL;
+  GtScaffolderGraphMemory growing;
+  GtUword max_nof_vertices, name_index_size, names_size, pair_index_size,
+          builder_lists, staged_edges, building, finalizing;
+
+  gt_assert(memory != NULL);
+
+  /* capacities reached by doubling in the builder, the name pool holds at
+     most twice the headers including their terminators */
+  max_nof_vertices = GT_SCAFFOLDER_GRAPH_BUILDER_INIT_SIZE;
+  while (max_nof_vertices < nof_vertices)
+    max_nof_vertices *= 2;
+  name_index_size = 2;
+  while (name_index_size < 2 * nof_vertices)
+    name_index_size *= 2;
+  names_size = 2 * (names_length + nof_vertices);
+  pair_index_size = GT_SCAFFOLDER_GRAPH_BUILDER_INIT_SIZE;
+  while (pair_index_size < 2 * nof_edges)
+    pair_index_size *= 2;
+
+  /* the final graph has shrunken vertex arrays and name pool, the number
+     index is assumed to have its maximal size */
+  gt_scaffolder_graph_memory_of(nof_vertices, nof_edges,
+                                names_length + nof_vertices, name_index_size,
+                                GT_SCAFFOLDER_GRAPH_NUMBER_INDEX_FACTOR *
+                                nof_vertices, memory);
+
+  builder_lists = 2 * max_nof_vertices * sizeof (*builder->first_edges);
+  /* the staged edges are reserved for all records at once */
+  staged_edges = nof_edges * sizeof (*builder->edges);
+
+  /* all edges are staged and indexed by their pair of vertices, the vertex
+     arrays are not yet shrunken */
+  gt_scaffolder_graph_memory_of(max_nof_vertices, 0, names_size,
+                                name_index_size, 0, &growing);
+  building = growing.total + builder_lists + staged_edges + records_size +
+             pair_index_size * sizeof (*builder->pair_index);
+
+  /* the final edges and the map of staged edge ids to final ones coexist
+     with the staged edges */
+  finalizing = memory->total + builder_lists + staged_edges + records_size +
+               MAX(nof_edges, nof_vertices) * sizeof (GtUword);
+
+  return MAX(building, finalizing);
+}
+
+/* returns representative of the set of vertex <vid> in the union-find
+   forest <parents>, halving the path on the way */
+static GtUword gt_scaffolder_graph_find_root(GtUword *parents, GtUword vid)
+{
+  while (parents[vid] != vid) {
+    parents[vid] = parents[parents[vid]];
+    vid = parents[vid];
+  }
+  return vid;
+}
+
+/* Extract the connected components of <*graph> into graphs of their own */
+GtScaffolderGraphComponents *
+gt_scaffolder_graph_components_new(const GtScaffolderGraph *graph)
+{
+  GtScaffolderGraphComponents *components;
+  GtScaffolderGraphComponent *component;
+  GtScaffolderGraph *sub;
+  GtUword *parents, *nof_edges, *local_edge_ids, vid, eid, end, root, cid,
+          lvid, leid, first;
+
+  gt_assert(graph != NULL);
+
+  /* union vertices connected by unmarked edges, the state of an edge may
+     differ from the state of its twin, so edges of both directions count */
+  parents = gt_malloc(sizeof (*parents) * graph->nof_vertices);
+  for (vid = 0; vid < graph->nof_vertices; vid++)
+    parents[vid] = vid;
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    if ((GIS_MASK(graph->vertex_states[vid]) & GIS_VERTEX_MARKED) != 0)
+      continue;
+    first = gt_scaffolder_graph_first_edge(graph, vid);
+    for (eid = first; eid < first + gt_scaffolder_graph_degree(graph, vid);
+         eid++) {
+      end = graph->edges[eid].end;
+      if ((GIS_MASK(graph->edge_states[eid]) & GIS_EDGE_MARKED) != 0 ||
+          (GIS_MASK(graph->vertex_states[end]) & GIS_VERTEX_MARKED) != 0)
+        continue;
+      root = gt_scaffolder_graph_find_root(parents, end);
+      parents[gt_scaffolder_graph_find_root(parents, vid)] = root;
+    }
+  }
+
+  /* number the components in the order of their smallest vertex id and the
+     vertices of each component in the order of their global ids */
+  components = gt_malloc(sizeof (*components));
+  components->nof_components = 0;
+  components->component_ids = gt_malloc(sizeof (*components->component_ids) *
+                                        graph->nof_vertices);
+  components->local_ids = gt_malloc(sizeof (*components->local_ids) *
+                                    graph->nof_vertices);
+  for (vid = 0; vid < graph->nof_vertices; vid++)
+    components->component_ids[vid] = GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    if ((GIS_MASK(graph->vertex_states[vid]) & GIS_VERTEX_MARKED) != 0)
+      continue;
+    root = gt_scaffolder_graph_find_root(parents, vid);
+    if (components->component_ids[root] == GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+      components->component_ids[root] = components->nof_components++;
+    components->component_ids[vid] = components->component_ids[root];
+  }
+  gt_free(parents);
+
+  /* count vertices and edges within every component */
+  components->components = gt_calloc(components->nof_components,
+                                     sizeof (*components->components));
+  nof_edges = gt_calloc(components->nof_components, sizeof (*nof_edges));
+  local_edge_ids = gt_malloc(sizeof (*local_edge_ids) * graph->max_nof_edges);
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    cid = components->component_ids[vid];
+    if (cid == GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+      continue;
+    component = components->components + cid;
+    if (component->graph == NULL) {
+      component->graph = gt_scaffolder_graph_new_empty();
+      component->graph->nof_vertices = 0;
+    }
+    components->local_ids[vid] = component->graph->nof_vertices++;
+    first = gt_scaffolder_graph_first_edge(graph, vid);
+    for (eid = first; eid < first + gt_scaffolder_graph_degree(graph, vid);
+         eid++) {
+      if (components->component_ids[graph->edges[eid].end] == cid &&
+          gt_scaffolder_graph_edge_is_live(graph, eid))
+        local_edge_ids[eid] = nof_edges[cid]++;
+    }
+  }
+
+  /* allocate component graphs, which hold at least one edge slot */
+  for (cid = 0; cid < components->nof_components; cid++) {
+    component = components->components + cid;
+    sub = component->graph;
+    lvid = sub->nof_vertices;
+    gt_scaffolder_graph_init_vertices(sub, lvid);
+    sub->nof_vertices = lvid;
+    gt_scaffolder_graph_init_edges(sub, MAX(nof_edges[cid], 1));
+    sub->nof_edges = nof_edges[cid];
+    component->vertex_ids = gt_malloc(sizeof (*component->vertex_ids) *
+                                      lvid);
+    component->edge_ids = gt_malloc(sizeof (*component->edge_ids) *
+                                    sub->max_nof_edges);
+    sub->edge_offsets[0] = 0;
+  }
+
+  /* copy vertices and edges, the local edges of a vertex are consecutive */
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    cid = components->component_ids[vid];
+    if (cid == GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+      continue;
+    component = components->components + cid;
+    sub = component->graph;
+    lvid = components->local_ids[vid];
+    component->vertex_ids[lvid] = vid;
+    sub->vertices[lvid] = graph->vertices[vid];
+    sub->vertices[lvid].name_offset =
+      gt_scaffolder_graph_add_name(sub, gt_scaffolder_graph_vertex_name(graph,
+                                   vid), graph->vertices[vid].name_length);
+    sub->vertex_states[lvid] = graph->vertex_states[vid];
+    sub->active_degrees[2 * lvid] = graph->active_degrees[2 * vid];
+    sub->active_degrees[2 * lvid + 1] = graph->active_degrees[2 * vid + 1];
+    sub->degrees[2 * lvid] = sub->degrees[2 * lvid + 1] = 0;
+    first = gt_scaffolder_graph_first_edge(graph, vid);
+    for (eid = first; eid < first + gt_scaffolder_graph_degree(graph, vid);
+         eid++) {
+      end = graph->edges[eid].end;
+      if (components->component_ids[end] != cid ||
+          !gt_scaffolder_graph_edge_is_live(graph, eid))
+        continue;
+      leid = local_edge_ids[eid];
+      component->edge_ids[leid] = eid;
+      sub->edges[leid] = graph->edges[eid];
+      sub->edges[leid].end = components->local_ids[end];
+      sub->edge_info[leid] = graph->edge_info[eid];
+      sub->edge_info[leid].start = lvid;
+      sub->edge_states[leid] = graph->edge_states[eid];
+      gt_scaffolder_graph_degree_in_dir(sub, lvid,
+        gt_scaffolder_graph_edge_sense(graph->edges + eid))++;
+    }
+    sub->edge_offsets[lvid + 1] = sub->edge_offsets[lvid] +
+                                  gt_scaffolder_graph_degree(sub, lvid);
+  }
+
+  /* twins connect the same vertices and thus belong to the same component */
+  for (cid = 0; cid < components->nof_components; cid++) {
+    component = components->components + cid;
+    sub = component->graph;
+    for (leid = 0; leid < sub->nof_edges; leid++) {
+      if (sub->edge_info[leid].twin != GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+        sub->edge_info[leid].twin =
+          local_edge_ids[sub->edge_info[leid].twin];
+    }
+    gt_scaffolder_graph_count_states(sub);
+  }
+
+  gt_free(nof_edges);
+  gt_free(local_edge_ids);
+
+  return components;
+}
+
+/* Free all memory allocated for <*components> including the component
+   graphs */
+void gt_scaffolder_graph_components_delete(GtScaffolderGraphComponents
+                                           *components)
+{
+  GtUword cid;
+
+  if (components == NULL)
+    return;
+
+  for (cid = 0; cid < components->nof_components; cid++) {
+    gt_scaffolder_graph_delete(components->components[cid].graph);
+    gt_free(components->components[cid].vertex_ids);
+    gt_free(components->components[cid].edge_ids);
+  }
+  gt_free(components->components);
+  gt_free(components->component_ids);
+  gt_free(components->local_ids);
+  gt_free(components);
 }
 
-/* assign edge <*edge> new attributes */
-void gt_scaffolder_graph_alter_edge(GtScaffolderGraphEdge *edge,
-                                    GtWord dist,
-                                    float std_dev,
-                                    GtUword num_pairs,
-                                    bool sense,
-                                    bool same)
+/* assign edge <edge> new attributes. Returns the new id of the edge, which
+   moves to the edges of the other direction if <sense> changes. */
+GtUword gt_scaffolder_graph_alter_edge(GtScaffolderGraph *graph,
+                                       GtUword edge,
+                                       GtWord dist,
+                                       float std_dev,
+                                       GtUword num_pairs,
+                                       bool sense,
+                                       bool same)
 {
+  GtUword start, split;
+  bool old_sense;
+
   /* check if edge exists */
-  gt_assert(edge != NULL);
+  gt_assert(graph != NULL);
+  gt_assert(edge < graph->max_nof_edges);
+
+  /* an unmarked edge changing its direction moves to the other counter */
+  start = gt_scaffolder_graph_edge_start(graph, edge);
+  old_sense = gt_scaffolder_graph_edge_sense(graph->edges + edge);
+  if ((GIS_MASK(graph->edge_states[edge]) & GIS_EDGE_MARKED) == 0) {
+    gt_scaffolder_graph_active_degree(graph, start, old_sense)--;
+    gt_scaffolder_graph_active_degree(graph, start, sense)++;
+  }
+
+  /* move the edge across the split point between antisense and sense edges,
+     it becomes the last antisense or the first sense edge */
+  if (old_sense != sense) {
+    split = gt_scaffolder_graph_first_edge_in_dir(graph, start, true);
+    if (sense) {
+      gt_scaffolder_graph_move_edge(graph, edge, split - 1);
+      edge = split - 1;
+    }
+    else {
+      gt_scaffolder_graph_move_edge(graph, edge, split);
+      edge = split;
+    }
+    gt_scaffolder_graph_degree_in_dir(graph, start, old_sense)--;
+    gt_scaffolder_graph_degree_in_dir(graph, start, sense)++;
+  }
 
   /* assign edge new attributes */
-  edge->dist = dist;
+  graph->edges[edge].dist = gt_scaffolder_graph_saturate_dist(dist);
+  graph->edges[edge].flags = (sense ? GT_SCAFFOLDER_GRAPH_SENSE : 0) |
+                             (same ? GT_SCAFFOLDER_GRAPH_SAME : 0);
+  graph->edge_info[edge].std_dev = std_dev;
+  graph->edge_info[edge].num_pairs =
+    gt_scaffolder_graph_saturate_count(num_pairs);
+
+  return edge;
+}
+
+/* Create builder for a scaffold graph with initially empty, growing vertex
+   and edge portion */
+GtScaffolderGraphBuilder *gt_scaffolder_graph_builder_new(void)
+{
+  GtScaffolderGraphBuilder *builder;
+
+  builder = gt_malloc(sizeof (*builder));
+  builder->graph = gt_scaffolder_graph_new_empty();
+  gt_scaffolder_graph_init_vertices(builder->graph,
+                                    GT_SCAFFOLDER_GRAPH_BUILDER_INIT_SIZE);
+  builder->first_edges = gt_malloc(sizeof (*builder->first_edges) *
+                                   GT_SCAFFOLDER_GRAPH_BUILDER_INIT_SIZE);
+  builder->last_edges = gt_malloc(sizeof (*builder->last_edges) *
+                                  GT_SCAFFOLDER_GRAPH_BUILDER_INIT_SIZE);
+  builder->edges = NULL;
+  builder->nof_edges = 0;
+  builder->max_nof_edges = 0;
+  builder->pair_index = NULL;
+  builder->pair_index_size = 0;
+  builder->nof_pairs = 0;
+
+  return builder;
+}
+
+/* Free all memory allocated for <*builder> including the graph, unless it was
+   handed out by gt_scaffolder_graph_builder_finalize */
+void gt_scaffolder_graph_builder_delete(GtScaffolderGraphBuilder *builder)
+{
+  if (builder == NULL)
+    return;
+
+  gt_scaffolder_graph_delete(builder->graph);
+  gt_free(builder->edges);
+  gt_free(builder->first_edges);
+  gt_free(builder->last_edges);
+  gt_free(builder->pair_index);
+  gt_free(builder);
+}
+
+/* returns hash of the ordered pair of vertices <vstart> and <vend> */
+static GtUword gt_scaffolder_graph_hash_pair(GtUword vstart, GtUword vend)
+{
+  GtUword hash;
+
+  /* multiplicative mixing, the high bits are folded into the low bits used
+     as slot */
+  hash = (vstart * 0x9E3779B1UL + vend) * 0x85EBCA6BUL;
+  return hash ^ (hash >> 16);
+}
+
+/* returns slot of the pair index of <*builder> holding the first staged edge
+   from <vstart> to <vend>, the free slot it belongs into if there is none */
+static GtUword
+gt_scaffolder_graph_builder_pair_slot(const GtScaffolderGraphBuilder *builder,
+                                      GtUword vstart,
+                                      GtUword vend)
+{
+  const GtScaffolderGraphStagedEdge *edge;
+  GtUword slot, mask;
+
+  mask = builder->pair_index_size - 1;
+  slot = gt_scaffolder_graph_hash_pair(vstart, vend) & mask;
+  while (builder->pair_index[slot] != GT_SCAFFOLDER_GRAPH_UNDEF_ID) {
+    edge = builder->edges + builder->pair_index[slot];
+    if (edge->start == vstart && edge->end == vend)
+      break;
+    slot = (slot + 1) & mask;
+  }
+  return slot;
+}
+
+/* rebuild the pair index of <*builder> with <size> slots, a power of 2, from
+   the staged edges in staging order */
+static void
+gt_scaffolder_graph_builder_resize_pair_index(GtScaffolderGraphBuilder
+                                              *builder,
+                                              GtUword size)
+{
+  GtUword eid, slot;
+
+  gt_assert((size & (size - 1)) == 0);
+
+  builder->pair_index = gt_realloc(builder->pair_index,
+                                   sizeof (*builder->pair_index) * size);
+  builder->pair_index_size = size;
+  for (slot = 0; slot < size; slot++)
+    builder->pair_index[slot] = GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+
+  builder->nof_pairs = 0;
+  for (eid = 0; eid < builder->nof_edges; eid++) {
+    slot = gt_scaffolder_graph_builder_pair_slot(builder,
+                                                 builder->edges[eid].start,
+                                                 builder->edges[eid].end);
+    if (builder->pair_index[slot] == GT_SCAFFOLDER_GRAPH_UNDEF_ID) {
+      builder->pair_index[slot] = eid;
+      builder->nof_pairs++;
+    }
+  }
+}
+
+/* Add a new vertex to the graph of <*builder>, enlarging the vertex portion
+   if necessary. The arguments are the same as for
+   gt_scaffolder_graph_add_vertex. */
+void gt_scaffolder_graph_builder_add_vertex(GtScaffolderGraphBuilder *builder,
+                                            const char *header_seq,
+                                            GtUword header_len,
+                                            GtUword seq_len,
+                                            GtUword seqnum,
+                                            float astat,
+                                            float copy_num)
+{
+  GtScaffolderGraph *graph;
+  GtUword vid;
+
+  gt_assert(builder != NULL);
+  gt_assert(builder->graph != NULL);
+  gt_assert(builder->graph->name_index == NULL);
+  gt_assert(builder->graph->nof_vertices < GT_SCAFFOLDER_GRAPH_UNDEF_ID);
+
+  graph = builder->graph;
+  if (graph->nof_vertices == graph->max_nof_vertices) {
+    gt_scaffolder_graph_resize_vertices(graph, 2 * graph->max_nof_vertices);
+    builder->first_edges = gt_realloc(builder->first_edges,
+                                      sizeof (*builder->first_edges) *
+                                      graph->max_nof_vertices);
+    builder->last_edges = gt_realloc(builder->last_edges,
+                                     sizeof (*builder->last_edges) *
+                                     graph->max_nof_vertices);
+  }
+
+  vid = graph->nof_vertices;
+  gt_scaffolder_graph_add_vertex(graph, header_seq, header_len, seq_len,
+                                 seqnum, astat, copy_num);
+  builder->first_edges[vid] = GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+  builder->last_edges[vid] = GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+}
+
+/* Stage a new edge in <*builder>. The arguments are the same as for
+   gt_scaffolder_graph_add_edge. Returns the id of the staged edge. */
+GtUword gt_scaffolder_graph_builder_add_edge(GtScaffolderGraphBuilder *builder,
+                                             GtUword vstart,
+                                             GtUword vend,
+                                             GtWord dist,
+                                             float std_dev,
+                                             GtUword num_pairs,
+                                             bool dir,
+                                             bool same)
+{
+  GtScaffolderGraphStagedEdge *edge;
+  GtUword nextfree, slot;
+
+  gt_assert(builder != NULL);
+  gt_assert(builder->graph != NULL);
+  gt_assert(vstart < builder->graph->nof_vertices);
+  gt_assert(vend < builder->graph->nof_vertices);
+  gt_assert(builder->nof_edges < GT_SCAFFOLDER_GRAPH_UNDEF_ID);
+
+  if (builder->nof_edges == builder->max_nof_edges) {
+    builder->max_nof_edges = MAX(2 * builder->max_nof_edges,
+                                 GT_SCAFFOLDER_GRAPH_BUILDER_INIT_SIZE);
+    builder->edges = gt_realloc(builder->edges, sizeof (*builder->edges) *
+                                builder->max_nof_edges);
+  }
+
+  nextfree = builder->nof_edges;
+  edge = builder->edges + nextfree;
+  edge->start = vstart;
+  edge->end = vend;
+  edge->twin = GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+  edge->next = GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+  edge->dist = gt_scaffolder_graph_saturate_dist(dist);
   edge->std_dev = std_dev;
-  edge->num_pairs = num_pairs;
-  edge->sense = sense;
-  edge->same = same;
+  edge->num_pairs = gt_scaffolder_graph_saturate_count(num_pairs);
+  edge->flags = (dir ? GT_SCAFFOLDER_GRAPH_SENSE : 0) |
+                (same ? GT_SCAFFOLDER_GRAPH_SAME : 0);
+
+  /* append to the list of the start vertex to keep the staging order */
+  if (builder->last_edges[vstart] == GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+    builder->first_edges[vstart] = nextfree;
+  else
+    builder->edges[builder->last_edges[vstart]].next = nextfree;
+  builder->last_edges[vstart] = nextfree;
+
+  builder->nof_edges++;
+
+  /* the pair index is kept at most half full, it refers to the first edge of
+     every pair of vertices */
+  if (2 * (builder->nof_pairs + 1) > builder->pair_index_size)
+    gt_scaffolder_graph_builder_resize_pair_index(builder,
+      MAX(2 * builder->pair_index_size, GT_SCAFFOLDER_GRAPH_BUILDER_INIT_SIZE));
+  slot = gt_scaffolder_graph_builder_pair_slot(builder, vstart, vend);
+  if (builder->pair_index[slot] == GT_SCAFFOLDER_GRAPH_UNDEF_ID) {
+    builder->pair_index[slot] = nextfree;
+    builder->nof_pairs++;
+  }
+
+  return nextfree;
 }
 
-/* determine vertex id*/
-GtUword gt_scaffolder_graph_get_vertex_id(const GtScaffolderGraph *graph,
-                                       const GtScaffolderGraphVertex *vertex)
+/* Enlarge the staged edge portion and the pair index of <*builder> to hold
+   at least <nof_edges> edges, so staging them needs no further
+   reallocation */
+void gt_scaffolder_graph_builder_reserve_edges(GtScaffolderGraphBuilder
+                                               *builder,
+                                               GtUword nof_edges)
 {
-  gt_assert(graph != NULL);
-  /* LG: gt_assert(graph->vertices != NULL); */
-  return (vertex - graph->vertices);
+  GtUword size;
+
+  gt_assert(builder != NULL);
+
+  if (nof_edges > builder->max_nof_edges) {
+    builder->max_nof_edges = nof_edges;
+    builder->edges = gt_realloc(builder->edges, sizeof (*builder->edges) *
+                                builder->max_nof_edges);
+  }
+
+  /* the pair index holds at most one entry per edge */
+  size = MAX(builder->pair_index_size, GT_SCAFFOLDER_GRAPH_BUILDER_INIT_SIZE);
+  while (size < 2 * nof_edges)
+    size *= 2;
+  if (size > builder->pair_index_size)
+    gt_scaffolder_graph_builder_resize_pair_index(builder, size);
+}
+
+/* Link staged edges <edge_1> and <edge_2>, which connect the same vertices in
+   opposite directions, as twins of each other */
+void gt_scaffolder_graph_builder_link_twins(GtScaffolderGraphBuilder *builder,
+                                            GtUword edge_1,
+                                            GtUword edge_2)
+{
+  gt_assert(builder != NULL);
+  gt_assert(builder->edges[edge_1].start == builder->edges[edge_2].end &&
+            builder->edges[edge_1].end == builder->edges[edge_2].start);
+
+  builder->edges[edge_1].twin = edge_2;
+  builder->edges[edge_2].twin = edge_1;
+}
+
+/* Returns id of the first staged edge from <vertex_1> to <vertex_2>,
+   GT_UNDEF_UWORD if there is none. The edge is looked up in constant
+   expected time regardless of the degree of <vertex_1>. */
+GtUword
+gt_scaffolder_graph_builder_find_edge(const GtScaffolderGraphBuilder *builder,
+                                      GtUword vertex_1,
+                                      GtUword vertex_2)
+{
+  GtUword slot;
+
+  if (builder->pair_index_size == 0)
+    return GT_UNDEF_UWORD;
+  slot = gt_scaffolder_graph_builder_pair_slot(builder, vertex_1, vertex_2);
+  if (builder->pair_index[slot] == GT_SCAFFOLDER_GRAPH_UNDEF_ID)
+    return GT_UNDEF_UWORD;
+  return builder->pair_index[slot];
+}
+
+/* assign staged edge <edge> new attributes */
+void gt_scaffolder_graph_builder_alter_edge(GtScaffolderGraphBuilder *builder,
+                                            GtUword edge,
+                                            GtWord dist,
+                                            float std_dev,
+                                            GtUword num_pairs,
+                                            bool sense,
+                                            bool same)
+{
+  gt_assert(builder != NULL);
+  gt_assert(edge < builder->nof_edges);
+
+  builder->edges[edge].dist = gt_scaffolder_graph_saturate_dist(dist);
+  builder->edges[edge].flags = (sense ? GT_SCAFFOLDER_GRAPH_SENSE : 0) |
+                               (same ? GT_SCAFFOLDER_GRAPH_SAME : 0);
+  builder->edges[edge].std_dev = std_dev;
+  builder->edges[edge].num_pairs =
+    gt_scaffolder_graph_saturate_count(num_pairs);
+}
+
+/* Move the staged edges of <*builder> into the compressed sparse row layout of
+   its graph, which needs at least one vertex and one edge. The antisense
+   edges of every vertex precede its sense edges, both keep the order in which
+   they were staged. Returns the graph, which is no longer owned by
+   <*builder>. */
+GtScaffolderGraph *
+gt_scaffolder_graph_builder_finalize(GtScaffolderGraphBuilder *builder)
+{
+  GtScaffolderGraph *graph;
+  GtScaffolderGraphStagedEdge *edge;
+  GtUword *positions, vid, eid;
+  bool sense;
+
+  gt_assert(builder != NULL);
+  gt_assert(builder->graph != NULL);
+  gt_assert(builder->graph->nof_vertices > 0);
+  gt_assert(builder->nof_edges > 0);
+
+  /* no more edges are staged */
+  gt_free(builder->pair_index);
+  builder->pair_index = NULL;
+  builder->pair_index_size = 0;
+  builder->nof_pairs = 0;
+
+  graph = builder->graph;
+  gt_scaffolder_graph_resize_vertices(graph, graph->nof_vertices);
+  graph->names = gt_realloc(graph->names, sizeof (*graph->names) *
+                            graph->names_length);
+  graph->names_size = graph->names_length;
+
+  /* counting sort of the staged edges by start vertex: the staging lists
+     yield the degrees, add_edge then fills the edge range of every vertex in
+     list order */
+  positions = gt_malloc(sizeof (*positions) *
+                        MAX(builder->nof_edges, graph->nof_vertices));
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    positions[vid] = 0;
+    for (eid = builder->first_edges[vid];
+         eid != GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+         eid = builder->edges[eid].next)
+      positions[vid]++;
+  }
+  gt_scaffolder_graph_init_adjacency(graph, positions);
+
+  /* the degrees are no longer needed, <positions> now maps staged edge ids to
+     final edge ids. Adding the antisense edges of a vertex first appends every
+     edge at the end of its range, so no edge has to be moved. */
+  for (vid = 0; vid < graph->nof_vertices; vid++) {
+    for (sense = false; ; sense = true) {
+      for (eid = builder->first_edges[vid];
+           eid != GT_SCAFFOLDER_GRAPH_UNDEF_ID;
+           eid = builder->edges[eid].next) {
+        edge = builder->edges + eid;
+        if (((edge->flags & GT_SCAFFOLDER_GRAPH_SENSE) != 0) != sense)
+          continue;
+        positions[eid] = gt_scaffolder_graph_add_edge(graph, vid, edge->end,
+                         edge->dist, edge->std_dev, edge->num_pairs, sense,
+                         (edge->flags & GT_SCAFFOLDER_GRAPH_SAME) != 0);
+      }
+      if (sense)
+        break;
+    }
+  }
+
+  /* staged twin ids are translated to final edge ids */
+  for (eid = 0; eid < builder->nof_edges; eid++) {
+    if (builder->edges[eid].twin != GT_SCAFFOLDER_GRAPH_UNDEF_ID &&
+        eid < builder->edges[eid].twin)
+      gt_scaffolder_graph_link_twins(graph, positions[eid],
+                                     positions[builder->edges[eid].twin]);
+  }
+
+  gt_free(positions);
+  gt_free(builder->edges);
+  builder->edges = NULL;
+  builder->nof_edges = 0;
+  builder->max_nof_edges = 0;
+  builder->graph = NULL;
+
+  return graph;
 }
 
 /* print graphrepresentation in dot-format into file filename */
@@ -269,8 +1688,7 @@ int gt_scaffolder_graph_print(const GtScaffolderGraph *g,
 void gt_scaffolder_graph_print_generic(const GtScaffolderGraph *g,
                                        GtFile *f)
 {
-  GtScaffolderGraphVertex *v;
-  GtScaffolderGraphEdge *e;
+  GtUword vid, eid;
   /* 0: GIS_UNVISITED, 1: GIS_POLYMORPHIC, 2: GIS_INCONSISTENT,
      3: GIS_REPEAT, 4: GIS_VISITED, 5: GIS_PROCESSED, 6: GIS_SCAFFOLD
      7: GIS_CYCLIC */
@@ -284,22 +1702,27 @@ void gt_scaffolder_graph_print_generic(const GtScaffolderGraph *g,
 
   /* iterate over all vertices and print them. add attribute color according
      to the current state */
-  for (v = g->vertices; v < (g->vertices + g->nof_vertices); v++) {
-    gt_file_xprintf(f, GT_WU " [color=\"%s\" label=\"%s\"];\n",
-                    gt_scaffolder_graph_get_vertex_id(g, v),
-                    color_array[v->state], gt_str_get(v->header_seq));
+  for (vid = 0; vid < g->nof_vertices; vid++) {
+    gt_file_xprintf(f, GT_WU " [color=\"%s\" label=\"%s\"];\n", vid,
+                    color_array[g->vertex_states[vid]],
+                    gt_scaffolder_graph_vertex_name(g, vid));
   }
 
   /* iterate over all edges and print them. add attribute color according to
      the current state and label the edge with the distance*/
-  for (e = g->edges; e < (g->edges + g->nof_edges); e++) {
-    gt_assert(e != NULL);
-    gt_file_xprintf(f,
-                    GT_WU " -> " GT_WU " [color=\"%s\" label="
-                    "\"" GT_WD "\" arrowhead=\"%s\"];\n",
-                    gt_scaffolder_graph_get_vertex_id(g, e->start),
-                    gt_scaffolder_graph_get_vertex_id(g, e->end),
-                    color_array[e->state], e->dist, e->sense?"normal":"inv");
+  for (vid = 0; vid < g->nof_vertices; vid++) {
+    for (eid = gt_scaffolder_graph_first_edge(g, vid);
+         eid < gt_scaffolder_graph_first_edge(g, vid) +
+               gt_scaffolder_graph_degree(g, vid); eid++) {
+      gt_file_xprintf(f,
+                      GT_WU " -> " GT_WU " [color=\"%s\" label="
+                      "\"" GT_WD "\" arrowhead=\"%s\"];\n",
+                      vid, (GtUword) g->edges[eid].end,
+                      color_array[g->edge_states[eid]],
+                      (GtWord) g->edges[eid].dist,
+                      gt_scaffolder_graph_edge_sense(g->edges + eid) ?
+                      "normal" : "inv");
+    }
   }
 
   /* print the last line into f */
@@ -310,8 +1733,7 @@ void gt_scaffolder_graph_print_generic(const GtScaffolderGraph *g,
 void gt_scaffolder_graph_print_scaffold(const GtScaffolderGraph *g,
                                         GtFile *f)
 {
-  GtScaffolderGraphVertex *v;
-  GtScaffolderGraphEdge *e;
+  GtUword vid, eid;
 
   gt_assert(g != NULL);
 
@@ -319,29 +1741,88 @@ void gt_scaffolder_graph_print_scaffold(const GtScaffolderGraph *g,
   gt_file_xprintf(f, "digraph {\n");
 
   /* iterate over all vertices and print just the scaffold vertices */
-  for (v = g->vertices; v < (g->vertices + g->nof_vertices); v++) {
-    if (v->state == GIS_SCAFFOLD)
-      gt_file_xprintf(f, GT_WU " [label=\"%s\"];\n",
-                      gt_scaffolder_graph_get_vertex_id(g, v),
-                      gt_str_get(v->header_seq));
+  for (vid = 0; vid < g->nof_vertices; vid++) {
+    if (g->vertex_states[vid] == GIS_SCAFFOLD)
+      gt_file_xprintf(f, GT_WU " [label=\"%s\"];\n", vid,
+                      gt_scaffolder_graph_vertex_name(g, vid));
   }
 
   /* iterate over all edges and print just the scaffold edges */
-  for (e = g->edges; e < (g->edges + g->nof_edges); e++) {
-    gt_assert(e != NULL);
-    if (e->state == GIS_SCAFFOLD)
-      gt_file_xprintf(f,
-                      GT_WU " -> " GT_WU " [label="
-                      "\"" GT_WD "\" arrowhead=\"%s\"];\n",
-                      gt_scaffolder_graph_get_vertex_id(g, e->start),
-                      gt_scaffolder_graph_get_vertex_id(g, e->end),
-                      e->dist, e->sense?"normal":"inv");
+  for (vid = 0; vid < g->nof_vertices; vid++) {
+    for (eid = gt_scaffolder_graph_first_edge(g, vid);
+         eid < gt_scaffolder_graph_first_edge(g, vid) +
+               gt_scaffolder_graph_degree(g, vid); eid++) {
+      if (g->edge_states[eid] == GIS_SCAFFOLD)
+        gt_file_xprintf(f,
+                        GT_WU " -> " GT_WU " [label="
+                        "\"" GT_WD "\" arrowhead=\"%s\"];\n",
+                        vid, (GtUword) g->edges[eid].end,
+                        (GtWord) g->edges[eid].dist,
+                        gt_scaffolder_graph_edge_sense(g->edges + eid) ?
+                        "normal" : "inv");
+    }
   }
 
   /* print the last line into f */
   gt_file_xprintf(f, "}\n");
 }
 
+/* create scaffold graph from the contigs of file <ctg_filename> and the
+   records of <*distances>, which are resolved against the contigs (see
+   gt_scaffolder_parser_distances_new) */
+int gt_scaffolder_graph_new_from_distances(GtScaffolderGraph **graph_par,
+                                           const char *ctg_filename,
+                                           GtUword min_ctg_len,
+                                           GtScaffolderParserDistances
+                                           *distances,
+                                           bool astat_is_annotated,
+                                           GtError *err)
+{
+  GtScaffolderGraphBuilder *builder;
+  GtScaffolderGraph *graph;
+  int had_err;
+
+  graph = NULL;
+
+  /* the contig file is read once, vertices and edges are collected by the
+     builder */
+  builder = gt_scaffolder_graph_builder_new();
+
+  /* parse contigs in FASTA-format and save them as vertices of
+     scaffold graph */
+  had_err = gt_scaffolder_parser_read_contigs(builder, ctg_filename,
+            min_ctg_len, astat_is_annotated, err);
+
+  if (had_err == 0)
+  {
+    /* save the distance records between the contigs as edges of scaffold
+       graph */
+    had_err = gt_scaffolder_parser_distances_resolve(distances,
+                                                     builder->graph, err);
+    if (had_err == 0)
+      had_err = gt_scaffolder_parser_stage_distances(distances, builder,
+                                                     false, err);
+  }
+
+  if (had_err == 0)
+  {
+    if (builder->graph->nof_vertices == 1 && builder->nof_edges == 0) {
+      fprintf(stderr, "Graph only contains 1 vertex and no edges: "
+                      "Did not perform scaffolding!\n");
+      exit(0);
+    }
+
+    /* lay out the edges of all vertices in one contiguous array */
+    graph = gt_scaffolder_graph_builder_finalize(builder);
+  }
+
+  gt_scaffolder_graph_builder_delete(builder);
+
+  *graph_par = graph;
+
+  return had_err;
+}
+
 /* create scaffold graph from file */
 int gt_scaffolder_graph_new_from_file(GtScaffolderGraph **graph_par,
                                       const char *ctg_filename,
@@ -350,62 +1831,322 @@ int gt_scaffolder_graph_new_from_file(GtScaffolderGraph **graph_par,
                                       bool astat_is_annotated,
                                       GtError *err)
 {
-  GtScaffolderGraph *graph;
+  GtScaffolderParserDistances *distances;
   int had_err;
-  GtUword nof_distances, nof_contigs;
-
-  graph = NULL;
 
-  /* count contigs */
-  had_err = gt_scaffolder_parser_count_contigs(ctg_filename, min_ctg_len,
-            &nof_contigs, err);
+  *graph_par = NULL;
 
+  /* parse distance information of contigs in abyss-dist-format, the
+     records are turned into edges once the contigs are known */
+  had_err = gt_scaffolder_parser_distances_new(&distances, dist_filename,
+                                               err);
   if (had_err == 0)
-  {
-    /* allocate memory for vertices of scaffolder graph */
+    had_err = gt_scaffolder_graph_new_from_distances(graph_par, ctg_filename,
+              min_ctg_len, distances, astat_is_annotated, err);
+  gt_scaffolder_parser_distances_delete(distances);
+
+  return had_err;
+}
 
-    /*graph = gt_scaffolder_graph_new(0, 0);*/
-    graph = gt_malloc(sizeof (*graph));
-    graph->vertices = NULL;
-    graph->edges = NULL;
+/* identification of binary snapshot files, the version has to be increased
+   whenever the layout of the graph arrays changes */
+#define GT_SCAFFOLDER_GRAPH_SNAPSHOT_MAGIC      "GTSCAFGR"
+#define GT_SCAFFOLDER_GRAPH_SNAPSHOT_VERSION    6U
+/* written in native byte order to reject files of machines with other byte
+   order */
+#define GT_SCAFFOLDER_GRAPH_SNAPSHOT_BYTE_ORDER 0x01020304U
+#define GT_SCAFFOLDER_GRAPH_SNAPSHOT_NOF_ARRAYS 11
+
+/* header of binary snapshot file. It is followed by the arrays vertices,
+   vertex_states, edge_offsets, degrees, edges, edge_info, edge_states, names,
+   name_index, active_degrees and number_index of the graph, each padded to
+   a multiple of 8 bytes. The arrays only contain ids and offsets, so the
+   file can be mapped to any address. */
+typedef struct {
+  char magic[8];
+  uint32_t version,
+           byte_order,
+           word_size,
+           vertex_size,
+           edge_size,
+           edge_info_size;
+  GtUword nof_vertices,
+          nof_edges,
+          max_nof_edges,
+          names_length,
+          name_index_size,
+          number_index_size,
+          number_min,
+          number_prefix_offset,
+          number_prefix_length,
+          vertex_census[GIS_NOF_STATES],
+          edge_census[GIS_NOF_STATES];
+  GtScaffolderGraphSnapshotSource source;
+} GtScaffolderGraphSnapshotHeader;
+
+/* round <size> up to the next multiple of 8 bytes */
+static size_t gt_scaffolder_graph_snapshot_align(size_t size)
+{
+  return (size + 7) & ~((size_t) 7);
+}
 
-    gt_scaffolder_graph_init_vertices(graph, nof_contigs);
-    /* parse contigs in FASTA-format and save them as vertices of
-     scaffold graph */
+/* calculate the size in bytes of every array in a snapshot with <*header> */
+static void
+gt_scaffolder_graph_snapshot_sizes(const GtScaffolderGraphSnapshotHeader
+                                   *header,
+                                   size_t *sizes)
+{
+  sizes[0] = sizeof (GtScaffolderGraphVertex) * header->nof_vertices;
+  sizes[1] = sizeof (GtUchar) * header->nof_vertices;
+  sizes[2] = sizeof (GtScaffolderGraphId) * (header->nof_vertices + 1);
+  sizes[3] = sizeof (GtScaffolderGraphId) * 2 * header->nof_vertices;
+  sizes[4] = sizeof (GtScaffolderGraphEdge) * header->max_nof_edges;
+  sizes[5] = sizeof (GtScaffolderGraphEdgeInfo) * header->max_nof_edges;
+  sizes[6] = sizeof (GtUchar) * header->max_nof_edges;
+  sizes[7] = sizeof (char) * header->names_length;
+  sizes[8] = sizeof (GtScaffolderGraphId) * header->name_index_size;
+  sizes[9] = sizeof (GtScaffolderGraphId) * 2 * header->nof_vertices;
+  sizes[10] = sizeof (GtScaffolderGraphId) * header->number_index_size;
+}
 
-    had_err = gt_scaffolder_parser_read_contigs(graph, ctg_filename,
-              min_ctg_len, astat_is_annotated, err);
+/* describe in <*source> the graph built from the contig file <ctg_filename>
+   and the DistEst file <dist_filename> by their sizes and modification
+   times, <renumbered> tells whether its vertices were renumbered */
+int gt_scaffolder_graph_snapshot_source_init(GtScaffolderGraphSnapshotSource
+                                             *source,
+                                             const char *ctg_filename,
+                                             const char *dist_filename,
+                                             bool renumbered,
+                                             GtError *err)
+{
+  struct stat ctg_sb, dist_sb;
+
+  gt_assert(source != NULL);
+
+  if (stat(ctg_filename, &ctg_sb) != 0) {
+    gt_error_set(err, "can not read contig file %s: %s", ctg_filename,
+                 strerror(errno));
+    return -1;
+  }
+  if (stat(dist_filename, &dist_sb) != 0) {
+    gt_error_set(err, "can not read distance file %s: %s", dist_filename,
+                 strerror(errno));
+    return -1;
   }
 
-  if (had_err == 0)
-  {
-    /* count distance information */
-    had_err = gt_scaffolder_parser_count_distances(graph, dist_filename,
-            &nof_distances, err);
+  /* zeroed as a whole, the source is compared and written byte by byte */
+  memset(source, 0, sizeof (*source));
+  source->contig_size = ctg_sb.st_size;
+  source->contig_mtime = ctg_sb.st_mtim.tv_sec;
+  source->contig_mtime_nsec = ctg_sb.st_mtim.tv_nsec;
+  source->distances_size = dist_sb.st_size;
+  source->distances_mtime = dist_sb.st_mtim.tv_sec;
+  source->distances_mtime_nsec = dist_sb.st_mtim.tv_nsec;
+  source->renumbered = renumbered ? 1 : 0;
+
+  return 0;
+}
+
+/* returns true if <*source_a> and <*source_b> describe the same input */
+bool gt_scaffolder_graph_snapshot_source_equal(const
+                                               GtScaffolderGraphSnapshotSource
+                                               *source_a,
+                                               const
+                                               GtScaffolderGraphSnapshotSource
+                                               *source_b)
+{
+  gt_assert(source_a != NULL && source_b != NULL);
+  return memcmp(source_a, source_b, sizeof (*source_a)) == 0;
+}
+
+/* write <*graph> including all vertex and edge states and the description
+   <*source> of its input into the binary snapshot file <filename> */
+int gt_scaffolder_graph_save(const GtScaffolderGraph *graph,
+                             const char *filename,
+                             const GtScaffolderGraphSnapshotSource *source,
+                             GtError *err)
+{
+  GtScaffolderGraphSnapshotHeader header;
+  size_t sizes[GT_SCAFFOLDER_GRAPH_SNAPSHOT_NOF_ARRAYS];
+  const void *arrays[GT_SCAFFOLDER_GRAPH_SNAPSHOT_NOF_ARRAYS];
+  const char padding[8] = {0};
+  FILE *file;
+  int had_err = 0;
+  GtUword i;
+
+  gt_assert(graph != NULL && source != NULL);
+  gt_assert(graph->edges != NULL);
+
+  file = fopen(filename, "wb");
+  if (file == NULL) {
+    had_err = -1;
+    gt_error_set(err, "can not create snapshot file %s", filename);
   }
 
-  if (had_err == 0)
-  {
-    if (nof_contigs == 1 && nof_distances == 0) {
-      fprintf(stderr, "Graph only contains 1 vertex and no edges: "
-                      "Did not perform scaffolding!\n");
-      exit(0);
+  if (had_err == 0) {
+    memset(&header, 0, sizeof (header));
+    memcpy(header.magic, GT_SCAFFOLDER_GRAPH_SNAPSHOT_MAGIC,
+           sizeof (header.magic));
+    header.version = GT_SCAFFOLDER_GRAPH_SNAPSHOT_VERSION;
+    header.byte_order = GT_SCAFFOLDER_GRAPH_SNAPSHOT_BYTE_ORDER;
+    header.word_size = sizeof (GtUword);
+    header.vertex_size = sizeof (GtScaffolderGraphVertex);
+    header.edge_size = sizeof (GtScaffolderGraphEdge);
+    header.edge_info_size = sizeof (GtScaffolderGraphEdgeInfo);
+    header.nof_vertices = graph->nof_vertices;
+    header.nof_edges = graph->nof_edges;
+    header.max_nof_edges = graph->max_nof_edges;
+    header.names_length = graph->names_length;
+    header.name_index_size = graph->name_index != NULL ?
+                             graph->name_index_size : 0;
+    memcpy(header.vertex_census, graph->vertex_census,
+           sizeof (header.vertex_census));
+    memcpy(header.edge_census, graph->edge_census,
+           sizeof (header.edge_census));
+    if (graph->number_index != NULL) {
+      header.number_index_size = graph->number_index_size;
+      header.number_min = graph->number_min;
+      header.number_prefix_offset = graph->number_prefix_offset;
+      header.number_prefix_length = graph->number_prefix_length;
     }
+    header.source = *source;
+
+    arrays[0] = graph->vertices;
+    arrays[1] = graph->vertex_states;
+    arrays[2] = graph->edge_offsets;
+    arrays[3] = graph->degrees;
+    arrays[4] = graph->edges;
+    arrays[5] = graph->edge_info;
+    arrays[6] = graph->edge_states;
+    arrays[7] = graph->names;
+    arrays[8] = graph->name_index;
+    arrays[9] = graph->active_degrees;
+    arrays[10] = graph->number_index;
+    gt_scaffolder_graph_snapshot_sizes(&header, sizes);
+
+    gt_xfwrite(&header, sizeof (header), 1, file);
+    for (i = 0; i < GT_SCAFFOLDER_GRAPH_SNAPSHOT_NOF_ARRAYS; i++) {
+      if (sizes[i] > 0)
+        gt_xfwrite(arrays[i], 1, sizes[i], file);
+      gt_xfwrite(padding, 1,
+                 gt_scaffolder_graph_snapshot_align(sizes[i]) - sizes[i],
+                 file);
+    }
+    if (fclose(file) != 0) {
+      had_err = -1;
+      gt_error_set(err, "can not write snapshot file %s", filename);
+    }
+  }
+
+  return had_err;
+}
 
-    /* allocate memory for edges of scaffolder graph */
-    gt_scaffolder_graph_init_edges(graph, nof_distances);
-    /* parse distance information of contigs in abyss-dist-format and
-       save them as edges of scaffold graph */
-    had_err = gt_scaffolder_parser_read_distances(dist_filename,
-              graph, false, err);
+/* create scaffold graph <**graph_par> from binary snapshot file <filename>
+   written by gt_scaffolder_graph_save and store the description of its input
+   in <*source>. The file is mapped into memory, changes of the graph are
+   private and do not alter the file. No vertices or edges can be added to
+   the loaded graph. */
+int gt_scaffolder_graph_load(GtScaffolderGraph **graph_par,
+                             const char *filename,
+                             GtScaffolderGraphSnapshotSource *source,
+                             GtError *err)
+{
+  GtScaffolderGraph *graph = NULL;
+  GtScaffolderGraphSnapshotHeader header;
+  size_t sizes[GT_SCAFFOLDER_GRAPH_SNAPSHOT_NOF_ARRAYS], total;
+  char *mapping = NULL, *arrays[GT_SCAFFOLDER_GRAPH_SNAPSHOT_NOF_ARRAYS];
+  struct stat sb;
+  int fd, had_err = 0;
+  GtUword i;
+
+  fd = open(filename, O_RDONLY);
+  if (fd == -1) {
+    had_err = -1;
+    gt_error_set(err, "can not read snapshot file %s: %s", filename,
+                 strerror(errno));
   }
 
-  if (had_err != 0)
-  {
-    gt_scaffolder_graph_delete(graph);
-    graph = NULL;
+  if (had_err == 0) {
+    gt_xfstat(fd, &sb);
+    if ((size_t) sb.st_size < sizeof (header)) {
+      had_err = -1;
+      gt_error_set(err, "snapshot file %s is truncated", filename);
+    }
+    else {
+      /* private mapping: the algorithms change states in place */
+      mapping = gt_xmmap(NULL, (size_t) sb.st_size, PROT_READ | PROT_WRITE,
+                         MAP_PRIVATE, fd, 0);
+    }
+    close(fd);
+  }
+
+  if (had_err == 0) {
+    memcpy(&header, mapping, sizeof (header));
+    if (memcmp(header.magic, GT_SCAFFOLDER_GRAPH_SNAPSHOT_MAGIC,
+               sizeof (header.magic)) != 0) {
+      had_err = -1;
+      gt_error_set(err, "%s is no scaffold graph snapshot file", filename);
+    }
+    else if (header.version != GT_SCAFFOLDER_GRAPH_SNAPSHOT_VERSION ||
+             header.byte_order != GT_SCAFFOLDER_GRAPH_SNAPSHOT_BYTE_ORDER ||
+             header.word_size != sizeof (GtUword) ||
+             header.vertex_size != sizeof (GtScaffolderGraphVertex) ||
+             header.edge_size != sizeof (GtScaffolderGraphEdge) ||
+             header.edge_info_size != sizeof (GtScaffolderGraphEdgeInfo)) {
+      had_err = -1;
+      gt_error_set(err, "snapshot file %s was written by an incompatible "
+                        "version or machine", filename);
+    }
   }
 
+  if (had_err == 0) {
+    gt_scaffolder_graph_snapshot_sizes(&header, sizes);
+    total = sizeof (header);
+    for (i = 0; i < GT_SCAFFOLDER_GRAPH_SNAPSHOT_NOF_ARRAYS; i++) {
+      arrays[i] = mapping + total;
+      total += gt_scaffolder_graph_snapshot_align(sizes[i]);
+    }
+    if (total != (size_t) sb.st_size) {
+      had_err = -1;
+      gt_error_set(err, "snapshot file %s has wrong size", filename);
+    }
+  }
+
+  if (had_err == 0) {
+    graph = gt_scaffolder_graph_new_empty();
+    graph->mapping = mapping;
+    graph->mapping_size = (size_t) sb.st_size;
+    graph->vertices = (GtScaffolderGraphVertex *) arrays[0];
+    graph->vertex_states = (GtUchar *) arrays[1];
+    graph->edge_offsets = (GtScaffolderGraphId *) arrays[2];
+    graph->degrees = (GtScaffolderGraphId *) arrays[3];
+    graph->edges = (GtScaffolderGraphEdge *) arrays[4];
+    graph->edge_info = (GtScaffolderGraphEdgeInfo *) arrays[5];
+    graph->edge_states = (GtUchar *) arrays[6];
+    graph->names = arrays[7];
+    graph->name_index = header.name_index_size > 0 ?
+                        (GtScaffolderGraphId *) arrays[8] : NULL;
+    graph->active_degrees = (GtScaffolderGraphId *) arrays[9];
+    graph->number_index = header.number_index_size > 0 ?
+                          (GtScaffolderGraphId *) arrays[10] : NULL;
+    graph->nof_vertices = graph->max_nof_vertices = header.nof_vertices;
+    graph->nof_edges = header.nof_edges;
+    graph->max_nof_edges = header.max_nof_edges;
+    graph->names_length = graph->names_size = header.names_length;
+    graph->name_index_size = header.name_index_size;
+    graph->number_index_size = header.number_index_size;
+    graph->number_min = header.number_min;
+    graph->number_prefix_offset = header.number_prefix_offset;
+    graph->number_prefix_length = header.number_prefix_length;
+    memcpy(graph->vertex_census, header.vertex_census,
+           sizeof (graph->vertex_census));
+    memcpy(graph->edge_census, header.edge_census,
+           sizeof (graph->edge_census));
+    *source = header.source;
+  }
+  else if (mapping != NULL)
+    gt_xmunmap(mapping, (size_t) sb.st_size);
+
   *graph_par = graph;
 
   return had_err;
@@ -434,11 +2175,8 @@ int gt_scaffolder_graph_test(GtUword max_nof_vertices,
   if (!init_vertices && !init_edges )
     graph = gt_scaffolder_graph_new(max_nof_vertices, max_nof_edges);
   /* Construct graph, don't init as this will be done later */
-  else {
-    graph = gt_malloc(sizeof (*graph));
-    graph->vertices = NULL;
-    graph->edges = NULL;
-  }
+  else
+    graph = gt_scaffolder_graph_new_empty();
 
   if (graph == NULL)
     had_err = -1;
@@ -452,34 +2190,44 @@ int gt_scaffolder_graph_test(GtUword max_nof_vertices,
       had_err = -1;
 
     for (i = 0; i < nof_vertices; i++) {
-      gt_scaffolder_graph_add_vertex(graph, gt_str_new_cstr("foobar"),
-                                     100, 20, 40);
-      /* Simply allocate maximum amount of memory for pointer to potentially
-         outgoing edges */
-      if (nof_edges > 0)
-        graph->vertices[i].edges
-          = gt_malloc(sizeof (*graph->vertices->edges) * nof_edges);
+      gt_scaffolder_graph_add_vertex(graph, "foobar", 6, 100, i, 20, 40);
     }
   }
 
   /* Init edge portion of graph. Connect every vertex with another vertex until
   <nof_edges> is reached. */
   if (init_edges) {
-    GtScaffolderGraphVertex *vertex1, *vertex2;
+    GtUword vertex1, vertex2;
+    GtUword *degrees;
     unsigned i;
-    vertex1 = graph->vertices;
-    vertex2 = graph->vertices;
-
-    gt_scaffolder_graph_init_edges(graph, max_nof_edges);
+    vertex1 = 0;
+    vertex2 = 0;
+
+    /* Reserve adjacency for the first <max_nof_edges> edges created by the
+       scheme below */
+    degrees = gt_calloc(graph->nof_vertices + 1, sizeof (*degrees));
+    for (i = 0; i < max_nof_edges; i++) {
+      if (vertex2 < nof_vertices - 1)
+        vertex2++;
+      else if (vertex1 < nof_vertices - 2) {
+        vertex1++;
+        vertex2 = vertex1 + 1;
+      }
+      degrees[vertex1]++;
+    }
+    gt_scaffolder_graph_init_adjacency(graph, degrees);
+    gt_free(degrees);
+    vertex1 = 0;
+    vertex2 = 0;
 
     if (graph->edges == NULL)
       had_err = -1;
 
     /* Connect 1st vertex with every other vertex, then 2nd one, etc */
     for (i = 0; i < nof_edges; i++) {
-      if (vertex2-graph->vertices < nof_vertices - 1)
+      if (vertex2 < nof_vertices - 1)
         vertex2++;
-      else if (vertex1-graph->vertices < nof_vertices - 2) {
+      else if (vertex1 < nof_vertices - 2) {
         vertex1++;
         vertex2 = vertex1 + 1;
       }
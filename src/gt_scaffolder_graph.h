@@ -22,61 +22,174 @@
 #include "core/hashmap_api.h"
 #include "core/str_api.h"
 #include "core/types_api.h"
+#include "core/undef_api.h"
 
 #ifndef GT_SCAFFOLDER_GRAPH_H
 #define GT_SCAFFOLDER_GRAPH_H
 
+#include <stdint.h>
+
 typedef enum { GIS_UNVISITED, GIS_POLYMORPHIC, GIS_INCONSISTENT,
                GIS_REPEAT, GIS_VISITED, GIS_PROCESSED,
                GIS_SCAFFOLD, GIS_CYCLIC} GraphItemState;
 
-/* vertex of scaffold graph (describes one contig) */
+/* number of GraphItemStates */
+#define GIS_NOF_STATES (GIS_CYCLIC + 1)
+
+/* bit of state <STATE> in masks over GraphItemState */
+#define GIS_MASK(STATE) (1U << (STATE))
+
+/* vertex states filtering a vertex out of the scaffold graph */
+#define GIS_VERTEX_MARKED \
+        (GIS_MASK(GIS_POLYMORPHIC) | GIS_MASK(GIS_REPEAT) | \
+         GIS_MASK(GIS_CYCLIC))
+
+/* edge states filtering an edge out of the scaffold graph */
+#define GIS_EDGE_MARKED \
+        (GIS_MASK(GIS_INCONSISTENT) | GIS_MASK(GIS_POLYMORPHIC) | \
+         GIS_MASK(GIS_CYCLIC) | GIS_MASK(GIS_REPEAT))
+
+/* flag bits of GtScaffolderGraphEdge, they describe the direction of the
+   corresponding contigs
+   sense = true & same = true: ctg1 & ctg2 in sense direction
+   sense = true & same = false: ctg1 in sense & ctg2 in antisense direction
+   sense = false & same = true: ctg1 & ctg2 in antisense direction
+   sense = false & same = false: ctg1 in antisense & ctg2 in sense direction*/
+#define GT_SCAFFOLDER_GRAPH_SENSE 1U
+#define GT_SCAFFOLDER_GRAPH_SAME  2U
+
+/* types of vertex and edge ids, distances and read pair counts stored in the
+   graph. Compiling with GT_SCAFFOLDER_COMPACT defined selects 32 bit values,
+   which nearly halves the size of the edge arrays. Graphs are then limited to
+   less than 2^32 - 1 vertices and edges, distances and pair counts saturate.
+   GT_SCAFFOLDER_GRAPH_UNDEF_ID is the undefined id in the arrays of the
+   graph, functions returning ids use GT_UNDEF_UWORD instead. */
+#ifdef GT_SCAFFOLDER_COMPACT
+typedef uint32_t GtScaffolderGraphId;
+typedef int32_t GtScaffolderGraphDist;
+typedef uint32_t GtScaffolderGraphCount;
+#define GT_SCAFFOLDER_GRAPH_UNDEF_ID UINT32_MAX
+
+/* convert distance <DIST> to GtScaffolderGraphDist, saturating */
+#define gt_scaffolder_graph_saturate_dist(DIST) \
+        ((DIST) > INT32_MAX ? INT32_MAX : \
+         (DIST) < INT32_MIN ? INT32_MIN : (GtScaffolderGraphDist) (DIST))
+
+/* convert pair count <COUNT> to GtScaffolderGraphCount, saturating */
+#define gt_scaffolder_graph_saturate_count(COUNT) \
+        ((COUNT) > UINT32_MAX ? UINT32_MAX : (GtScaffolderGraphCount) (COUNT))
+#else
+typedef GtUword GtScaffolderGraphId;
+typedef GtWord GtScaffolderGraphDist;
+typedef GtUword GtScaffolderGraphCount;
+#define GT_SCAFFOLDER_GRAPH_UNDEF_ID GT_UNDEF_UWORD
+#define gt_scaffolder_graph_saturate_dist(DIST)   (DIST)
+#define gt_scaffolder_graph_saturate_count(COUNT) (COUNT)
+#endif
+
+/* payload of a vertex of scaffold graph (describes one contig), the vertex
+   state and the adjacency are stored in separate arrays of the graph */
 typedef struct GtScaffolderGraphVertex {
-  /* header sequence of corresponding contig */
-  GtStr *header_seq;
+  /* position and length of the header sequence of corresponding contig in
+     the name pool of the graph (see gt_scaffolder_graph_vertex_name) */
+  GtUword name_offset;
+  GtUword name_length;
   /* sequence length of corresponding contig */
   GtUword seq_len;
+  /* number of corresponding contig in the contig FASTA file */
+  GtUword seqnum;
   /* a-statistics value for classifying contig as repeat or unique contig */
   float astat;
   /* estimated copy number of corresponding contig */
   float copy_num;
-  GtUword nof_edges;
-  struct GtScaffolderGraphEdge **edges;
-  /* vertex state (vertex can adapt every state except GIS_INCONSISTENT) */
-  GraphItemState state;
 } GtScaffolderGraphVertex;
 
-/* edge of scaffold graph (describes orientation of two contigs) */
+/* edge of scaffold graph (describes orientation of two contigs), holds the
+   data needed during graph traversal */
 typedef struct GtScaffolderGraphEdge {
-  /* pointer to end vertex of edge */
-  GtScaffolderGraphVertex *end;
-  /* pointer to start vertex of edge */
-  GtScaffolderGraphVertex *start;
+  /* id of end vertex of edge */
+  GtScaffolderGraphId end;
   /* estimated distance between contigs of start and end vertex */
-  GtWord dist;
+  GtScaffolderGraphDist dist;
+  /* GT_SCAFFOLDER_GRAPH_SENSE and GT_SCAFFOLDER_GRAPH_SAME */
+  GtUchar flags;
+} GtScaffolderGraphEdge;
+
+/* remaining data of an edge of scaffold graph */
+typedef struct GtScaffolderGraphEdgeInfo {
+  /* id of start vertex of edge */
+  GtScaffolderGraphId start;
+  /* id of twin edge from end to start vertex, GT_SCAFFOLDER_GRAPH_UNDEF_ID if
+     the edge was added without twin */
+  GtScaffolderGraphId twin;
   /* standard deviation of estimated distance */
   float std_dev;
   /* number of read pairs resulting that distance */
-  GtUword num_pairs;
-  /* edge state */
-  GraphItemState state;
-  /* describes direction of corresponding contigs
-     sense = true & same = true: ctg1 & ctg2 in sense direction
-     sense = true & same = false: ctg1 in sense & ctg2 in antisense direction
-     sense = false & same = true: ctg1 & ctg2 in antisense direction
-     sense = false & same = false: ctg1 in antisense & ctg2 in sense direction*/
-  bool sense;
-  bool same;
-} GtScaffolderGraphEdge;
+  GtScaffolderGraphCount num_pairs;
+} GtScaffolderGraphEdgeInfo;
 
-/* scaffold graph */
+/* scaffold graph, vertices and edges are referred to by their ids, which are
+   their indices in the arrays below */
 typedef struct GtScaffolderGraph {
   GtScaffolderGraphVertex *vertices;
+  /* GraphItemState of every vertex (vertex can adapt every state except
+     GIS_INCONSISTENT) */
+  GtUchar *vertex_states;
   GtUword nof_vertices;
   GtUword max_nof_vertices;
+  /* adjacency in compressed sparse row format: the edges of the vertex with id
+     i occupy the slots edge_offsets[i] to edge_offsets[i+1] - 1 of <edges>.
+     The first degrees[2 * i] of them leave the vertex in antisense direction,
+     the following degrees[2 * i + 1] in sense direction, the remaining slots
+     are unused. */
+  GtScaffolderGraphId *edge_offsets;
+  GtScaffolderGraphId *degrees;
+  /* number of unmarked edges (see GIS_EDGE_MARKED) of every vertex in
+     antisense (index 2 * vid) and sense direction (index 2 * vid + 1), kept
+     up to date by gt_scaffolder_graph_set_edge_state */
+  GtScaffolderGraphId *active_degrees;
   GtScaffolderGraphEdge *edges;
+  GtScaffolderGraphEdgeInfo *edge_info;
+  /* GraphItemState of every edge */
+  GtUchar *edge_states;
   GtUword nof_edges;
   GtUword max_nof_edges;
+  /* number of vertices and edges in every GraphItemState, kept up to date by
+     gt_scaffolder_graph_set_vertex_state and
+     gt_scaffolder_graph_set_edge_state */
+  GtUword vertex_census[GIS_NOF_STATES];
+  GtUword edge_census[GIS_NOF_STATES];
+  /* append-only name pool holding the header sequences of all vertices, each
+     terminated by '\0' */
+  char *names;
+  GtUword names_length;
+  GtUword names_size;
+  /* open addressing hash table from contig header to vertex id, unused slots
+     are GT_SCAFFOLDER_GRAPH_UNDEF_ID, the size is a power of two */
+  GtScaffolderGraphId *name_index;
+  GtUword name_index_size;
+  /* dense table from number to vertex id for contig headers consisting of a
+     common prefix and a decimal number without leading zeros, like
+     contig-4616. Slot i belongs to number number_min + i, unused slots are
+     GT_SCAFFOLDER_GRAPH_UNDEF_ID. The prefix of number_prefix_length bytes
+     starts at offset number_prefix_offset of the name pool. NULL if the
+     headers are not numbered densely enough. */
+  GtScaffolderGraphId *number_index;
+  GtUword number_index_size;
+  GtUword number_min;
+  GtUword number_prefix_offset;
+  GtUword number_prefix_length;
+  /* private memory mapping of a binary snapshot holding all arrays above,
+     NULL if they are allocated separately (see gt_scaffolder_graph_load) */
+  void *mapping;
+  size_t mapping_size;
+  /* true if only the state arrays and active_degrees belong to this graph
+     and everything else is shared (see gt_scaffolder_graph_new_view) */
+  bool is_view;
+  /* id of every edge in the graph this view was compacted from, the view
+     then also owns its adjacency and edges, NULL otherwise (see
+     gt_scaffolder_graph_new_compacted) */
+  GtScaffolderGraphId *edge_ids;
 } GtScaffolderGraph;
 
 /* linear scaffold */
@@ -84,66 +197,384 @@ typedef struct GtScaffolderGraphWalk {
   GtUword nof_edges;
   GtUword size;
   GtUword total_contig_len;
-  GtScaffolderGraphEdge **edges;
+  /* edge ids */
+  GtUword *edges;
 }GtScaffolderGraphWalk;
 
-/* node */
+/* node of the walk search, <edge> holds the id of a link between contig
+   sides (see GtScaffolderBidirectedGraph) */
 typedef struct GtScaffolderGraphNode {
-  GtScaffolderGraphEdge *edge;
+  GtUword edge;
   GtWord dist;
 }GtScaffolderGraphNode;
 
-/* Datatype to store the scaffolds */
+/* Datatype to store the scaffolds, <edges> holds edge ids */
 typedef struct GtScaffolderGraphRecord {
-  GtScaffolderGraphVertex *root;
+  GtUword root;
   GtArray *edges;
 }GtScaffolderGraphRecord;
 
+/* edge staged in GtScaffolderGraphBuilder */
+typedef struct GtScaffolderGraphStagedEdge {
+  GtScaffolderGraphId start;
+  GtScaffolderGraphId end;
+  /* id of the staged twin edge, GT_SCAFFOLDER_GRAPH_UNDEF_ID if not linked */
+  GtScaffolderGraphId twin;
+  /* next staged edge with the same start vertex,
+     GT_SCAFFOLDER_GRAPH_UNDEF_ID if last */
+  GtScaffolderGraphId next;
+  GtScaffolderGraphDist dist;
+  float std_dev;
+  GtScaffolderGraphCount num_pairs;
+  GtUchar flags;
+}GtScaffolderGraphStagedEdge;
+
+/* Constructs a scaffold graph in a single pass over the input. Vertices are
+   appended to the growing vertex portion of <graph>, edges are staged in
+   per-vertex lists until gt_scaffolder_graph_builder_finalize moves them into
+   the compressed sparse row layout. */
+typedef struct GtScaffolderGraphBuilder {
+  GtScaffolderGraph *graph;
+  GtScaffolderGraphStagedEdge *edges;
+  GtUword nof_edges;
+  GtUword max_nof_edges;
+  /* first and last staged edge of every vertex, GT_SCAFFOLDER_GRAPH_UNDEF_ID
+     if none */
+  GtScaffolderGraphId *first_edges;
+  GtScaffolderGraphId *last_edges;
+  /* open addressing hash table of the first staged edge between every
+     ordered pair of vertices, GT_SCAFFOLDER_GRAPH_UNDEF_ID marks free
+     slots */
+  GtScaffolderGraphId *pair_index;
+  GtUword pair_index_size;
+  GtUword nof_pairs;
+}GtScaffolderGraphBuilder;
+
+/* copy of the vertex and edge states of a scaffold graph together with the
+   number of unmarked edges of every vertex, kept in one buffer, and the
+   number of vertices and edges in every state */
+typedef struct GtScaffolderGraphStates {
+  GtUword nof_vertices;
+  GtUword max_nof_edges;
+  GtScaffolderGraphId *active_degrees;
+  GtUchar *vertex_states;
+  GtUchar *edge_states;
+  GtUword vertex_census[GIS_NOF_STATES];
+  GtUword edge_census[GIS_NOF_STATES];
+}GtScaffolderGraphStates;
+
+/* memory of the arrays of a scaffold graph in bytes */
+typedef struct GtScaffolderGraphMemory {
+  /* vertex payload, vertex states and numbers of unmarked edges */
+  GtUword vertices;
+  /* edge offsets and degrees of the vertices */
+  GtUword adjacency;
+  /* edges, remaining edge data and edge states */
+  GtUword edges;
+  /* name pool and hash index of the contig headers */
+  GtUword names;
+  GtUword total;
+}GtScaffolderGraphMemory;
+
+/* connected component of a scaffold graph extracted into a graph of its own,
+   whose vertices and edges have local ids */
+typedef struct GtScaffolderGraphComponent {
+  GtScaffolderGraph *graph;
+  /* global id of every local vertex and edge */
+  GtScaffolderGraphId *vertex_ids;
+  GtScaffolderGraphId *edge_ids;
+}GtScaffolderGraphComponent;
+
+/* all connected components of a scaffold graph
+   (see gt_scaffolder_graph_components_new) */
+typedef struct GtScaffolderGraphComponents {
+  GtUword nof_components;
+  GtScaffolderGraphComponent *components;
+  /* component and local id of every vertex of the scaffold graph,
+     GT_SCAFFOLDER_GRAPH_UNDEF_ID for marked vertices */
+  GtScaffolderGraphId *component_ids;
+  GtScaffolderGraphId *local_ids;
+}GtScaffolderGraphComponents;
+
+/* returns '\0'-terminated header sequence of vertex <VID> in <GRAPH> */
+#define gt_scaffolder_graph_vertex_name(GRAPH, VID) \
+        ((GRAPH)->names + (GRAPH)->vertices[VID].name_offset)
+
+/* returns id of the first outgoing edge of vertex <VID> in <GRAPH>, the
+   outgoing edges of a vertex have consecutive ids */
+#define gt_scaffolder_graph_first_edge(GRAPH, VID) \
+        ((GRAPH)->edge_offsets[VID])
+
+/* returns number of outgoing edges of vertex <VID> in <GRAPH> */
+#define gt_scaffolder_graph_degree(GRAPH, VID) \
+        ((GRAPH)->degrees[2 * (VID)] + (GRAPH)->degrees[2 * (VID) + 1])
+
+/* returns id of the first edge of vertex <VID> in <GRAPH> leaving it in sense
+   direction if <SENSE> is true and in antisense direction otherwise, the
+   edges of a vertex in one direction have consecutive ids */
+#define gt_scaffolder_graph_first_edge_in_dir(GRAPH, VID, SENSE) \
+        ((GRAPH)->edge_offsets[VID] + ((SENSE) ? (GRAPH)->degrees[2 * (VID)] \
+                                               : 0))
+
+/* returns number of edges of vertex <VID> in <GRAPH> leaving it in sense
+   direction if <SENSE> is true and in antisense direction otherwise */
+#define gt_scaffolder_graph_degree_in_dir(GRAPH, VID, SENSE) \
+        ((GRAPH)->degrees[2 * (VID) + ((SENSE) ? 1 : 0)])
+
+/* returns number of unmarked edges of vertex <VID> in <GRAPH> leaving it in
+   sense direction if <SENSE> is true and in antisense direction otherwise */
+#define gt_scaffolder_graph_active_degree(GRAPH, VID, SENSE) \
+        ((GRAPH)->active_degrees[2 * (VID) + ((SENSE) ? 1 : 0)])
+
+/* returns true if edge <*EDGE> leaves its start vertex in sense direction */
+#define gt_scaffolder_graph_edge_sense(EDGE) \
+        (((EDGE)->flags & GT_SCAFFOLDER_GRAPH_SENSE) != 0)
+
+/* returns true if the contigs of edge <*EDGE> have the same direction */
+#define gt_scaffolder_graph_edge_same(EDGE) \
+        (((EDGE)->flags & GT_SCAFFOLDER_GRAPH_SAME) != 0)
+
+/* returns id of the start vertex of edge <EID> */
+#define gt_scaffolder_graph_edge_start(GRAPH, EID) \
+        ((GRAPH)->edge_info[EID].start)
+
+/* returns id of the twin of edge <EID> (see gt_scaffolder_graph_link_twins),
+   GT_UNDEF_UWORD if it has none */
+#define gt_scaffolder_graph_edge_twin(GRAPH, EID) \
+        ((GRAPH)->edge_info[EID].twin == GT_SCAFFOLDER_GRAPH_UNDEF_ID ? \
+         GT_UNDEF_UWORD : (GtUword) (GRAPH)->edge_info[EID].twin)
+
 /* Free all memory allocated for <*graph> including vertices and edges */
 void gt_scaffolder_graph_delete(GtScaffolderGraph *graph);
 
+/* Create a view of <*graph>, which shares its vertices, edges and names but
+   has its own copy of the vertex and edge states. Views of the same graph
+   can be processed by the algorithms concurrently, <*graph> must neither be
+   changed nor deleted while views exist. */
+GtScaffolderGraph *gt_scaffolder_graph_new_view(const GtScaffolderGraph *graph);
+
+/* Create a compacted view of <*graph>, which shares its vertices and names
+   but only holds the live edges: edges between unmarked vertices, which are
+   unmarked themselves or have an unmarked twin. The vertex ids stay the same,
+   the edges of every vertex keep their order and <edge_ids> of the view maps
+   them to the edges of <*graph>. The traversals of the algorithms no longer
+   skip the filtered edges, which stay in <*graph> for diagnostics. The
+   states of the view are transferred back by
+   gt_scaffolder_graph_merge_compacted. */
+GtScaffolderGraph *
+gt_scaffolder_graph_new_compacted(const GtScaffolderGraph *graph);
+
 /* Initialize a new vertex in <*graph>. Each vertex represents a contig and
-   contains information about the sequence header <*header_seq>, sequence
-   length <seq_len>, A-statistics <astat> and estimated copy number <copy_num>*/
+   contains information about the sequence header <*header_seq> of length
+   <header_len>, which is copied into the name pool, sequence length <seq_len>,
+   number <seqnum> of the contig in the FASTA file, A-statistics <astat> and
+   estimated copy number <copy_num>*/
 void gt_scaffolder_graph_add_vertex(GtScaffolderGraph *graph,
-                                    GtStr *header_seq,
+                                    const char *header_seq,
+                                    GtUword header_len,
                                     GtUword seq_len,
+                                    GtUword seqnum,
                                     float astat,
                                     float copy_num);
 
+/* Build the hash index from contig header to vertex for all vertices of
+   <*graph>. If the headers share a prefix followed by densely used numbers,
+   a table from number to vertex is built as well, which lets
+   gt_scaffolder_graph_get_vertex skip hashing for these headers. Has to be
+   called once after all vertices are added. */
+void gt_scaffolder_graph_index_vertices(GtScaffolderGraph *graph);
+
 /* Initialize a new edge in <*graph>. Each edge between two contig
    vertices <vstartID> and <vendID> contains information about the distance
    <dist>, standard deviation <std_dev>, number of pairs <num_pairs> and the
-   direction of <vstartID> <dir> and corresponding <vendID> <same> */
-void gt_scaffolder_graph_add_edge(GtScaffolderGraph *graph,
-                                  GtScaffolderGraphVertex *vstart,
-                                  GtScaffolderGraphVertex *vend,
-                                  GtWord dist,
-                                  float std_dev,
-                                  GtUword num_pairs,
-                                  bool dir,
-                                  bool same);
-
-GtScaffolderGraphEdge
-*gt_scaffolder_graph_find_edge(const GtScaffolderGraphVertex *vertex_1,
-                               const GtScaffolderGraphVertex *vertex_2);
-
-/* determines vertex id */
-GtUword gt_scaffolder_graph_get_vertex_id(const GtScaffolderGraph *graph,
-                                       const GtScaffolderGraphVertex *vertex);
-
-/* determines corresponding vertex to contig header */
+   direction of <vstartID> <dir> and corresponding <vendID> <same>.
+   Returns the id of the new edge. A new antisense edge is inserted in front
+   of the sense edges of <vstartID>, which move by one slot. */
+GtUword gt_scaffolder_graph_add_edge(GtScaffolderGraph *graph,
+                                     GtUword vstart,
+                                     GtUword vend,
+                                     GtWord dist,
+                                     float std_dev,
+                                     GtUword num_pairs,
+                                     bool dir,
+                                     bool same);
+
+/* Link edges <edge_1> and <edge_2>, which connect the same vertices in
+   opposite directions, as twins of each other */
+void gt_scaffolder_graph_link_twins(GtScaffolderGraph *graph,
+                                    GtUword edge_1,
+                                    GtUword edge_2);
+
+/* Reserve the edge portion of <*graph> in compressed sparse row layout. The
+   vertex with id i gets <degrees[i]> consecutive slots for outgoing edges. */
+void gt_scaffolder_graph_init_adjacency(GtScaffolderGraph *graph,
+                                        const GtUword *degrees);
+
+/* Returns id of edge from <vertex_1> to <vertex_2>, GT_UNDEF_UWORD if there
+   is none */
+GtUword gt_scaffolder_graph_find_edge(const GtScaffolderGraph *graph,
+                                      GtUword vertex_1,
+                                      GtUword vertex_2);
+
+/* determines id <*vertex> of the vertex corresponding to contig header
+   <*header_seq> of length <header_len> using the hash index, returns false if
+   no vertex belongs to <header_seq> */
 bool gt_scaffolder_graph_get_vertex(const GtScaffolderGraph *graph,
-                                    GtScaffolderGraphVertex **vertex,
-                                    const GtStr *header_seq);
+                                    GtUword *vertex,
+                                    const char *header_seq,
+                                    GtUword header_len);
+
+/* Renumber the vertices of <*graph> in breadth first order of its connected
+   components, which are visited in the order of their smallest vertex id.
+   The edges are rearranged accordingly, so that adjacent vertices and their
+   edges are close to each other in memory. All vertex and edge ids change,
+   lookups by contig header keep working. */
+void gt_scaffolder_graph_renumber_vertices(GtScaffolderGraph *graph);
+
+/* set state of edge <edge> in <*graph> to <state> and update the number of
+   unmarked edges of its start vertex and the number of edges per state */
+void gt_scaffolder_graph_set_edge_state(GtScaffolderGraph *graph,
+                                        GtUword edge,
+                                        GraphItemState state);
+
+/* set state of vertex <vertex> in <*graph> to <state> and update the number
+   of vertices per state */
+void gt_scaffolder_graph_set_vertex_state(GtScaffolderGraph *graph,
+                                          GtUword vertex,
+                                          GraphItemState state);
+
+/* returns number of vertices of <GRAPH> in GraphItemState <STATE> */
+#define gt_scaffolder_graph_nof_vertices_in_state(GRAPH, STATE) \
+        ((GRAPH)->vertex_census[STATE])
+
+/* returns number of edges of <GRAPH> in GraphItemState <STATE> */
+#define gt_scaffolder_graph_nof_edges_in_state(GRAPH, STATE) \
+        ((GRAPH)->edge_census[STATE])
+
+/* Capture the states of all vertices and edges of <*graph>, the topology is
+   not copied */
+GtScaffolderGraphStates *
+gt_scaffolder_graph_states_new(const GtScaffolderGraph *graph);
+
+/* Overwrite the states of all vertices and edges of <*graph> with <*states>,
+   which were captured from the same graph */
+void gt_scaffolder_graph_states_restore(GtScaffolderGraph *graph,
+                                        const GtScaffolderGraphStates *states);
+
+/* Free all memory allocated for <*states> */
+void gt_scaffolder_graph_states_delete(GtScaffolderGraphStates *states);
+
+/* Store the memory allocated for the arrays of <*graph> in <*memory>. The
+   arrays a view shares with its graph count as well. */
+void gt_scaffolder_graph_memory(const GtScaffolderGraph *graph,
+                                GtScaffolderGraphMemory *memory);
+
+/* Estimate the memory of a graph with <nof_vertices> vertices, at most
+   <nof_edges> edges and contig headers of total length <names_length> before
+   it is built. The contigs are counted by gt_scaffolder_parser_count_contigs,
+   every record of a DistEst file yields at most one edge and its twin.
+   Stores the memory of the final graph in <*memory> and returns the peak
+   memory of gt_scaffolder_graph_new_from_file, which holds the distance
+   records of <records_size> bytes, the staged and the final edges at the
+   same time. The estimate is an upper bound for the counts given. */
+GtUword gt_scaffolder_graph_estimate_memory(GtUword nof_vertices,
+                                            GtUword nof_edges,
+                                            GtUword names_length,
+                                            GtUword records_size,
+                                            GtScaffolderGraphMemory *memory);
+
+/* Extract the connected components of <*graph> into graphs of their own. A
+   component consists of unmarked vertices connected by unmarked edges in any
+   direction and keeps the edges between its vertices together with their
+   states. The local ids follow the order of the global ids, the numbers of
+   unmarked edges are those of <*graph>. The components are numbered in the
+   order of their smallest vertex id, marked vertices belong to none. Like
+   gt_scaffolder_graph_new_compacted the components only hold the live edges.
+   The component graphs have no hash index of contig headers. */
+GtScaffolderGraphComponents *
+gt_scaffolder_graph_components_new(const GtScaffolderGraph *graph);
+
+/* Free all memory allocated for <*components> including the component
+   graphs */
+void gt_scaffolder_graph_components_delete(GtScaffolderGraphComponents
+                                           *components);
 
-/* assign edge <*edge> new attributes */
-void gt_scaffolder_graph_alter_edge(GtScaffolderGraphEdge *edge,
-                                    GtWord dist,
-                                    float std_dev,
-                                    GtUword num_pairs,
-                                    bool sense,
-                                    bool same);
+/* assign edge <edge> new attributes. Returns the new id of the edge, which
+   moves to the edges of the other direction if <sense> changes. */
+GtUword gt_scaffolder_graph_alter_edge(GtScaffolderGraph *graph,
+                                       GtUword edge,
+                                       GtWord dist,
+                                       float std_dev,
+                                       GtUword num_pairs,
+                                       bool sense,
+                                       bool same);
+
+/* Create builder for a scaffold graph with initially empty, growing vertex
+   and edge portion */
+GtScaffolderGraphBuilder *gt_scaffolder_graph_builder_new(void);
+
+/* Free all memory allocated for <*builder> including the graph, unless it was
+   handed out by gt_scaffolder_graph_builder_finalize */
+void gt_scaffolder_graph_builder_delete(GtScaffolderGraphBuilder *builder);
+
+/* Add a new vertex to the graph of <*builder>, enlarging the vertex portion
+   if necessary. The arguments are the same as for
+   gt_scaffolder_graph_add_vertex. */
+void gt_scaffolder_graph_builder_add_vertex(GtScaffolderGraphBuilder *builder,
+                                            const char *header_seq,
+                                            GtUword header_len,
+                                            GtUword seq_len,
+                                            GtUword seqnum,
+                                            float astat,
+                                            float copy_num);
+
+/* Stage a new edge in <*builder>. The arguments are the same as for
+   gt_scaffolder_graph_add_edge. Returns the id of the staged edge. */
+GtUword gt_scaffolder_graph_builder_add_edge(GtScaffolderGraphBuilder *builder,
+                                             GtUword vstart,
+                                             GtUword vend,
+                                             GtWord dist,
+                                             float std_dev,
+                                             GtUword num_pairs,
+                                             bool dir,
+                                             bool same);
+
+/* Enlarge the staged edge portion and the pair index of <*builder> to hold
+   at least <nof_edges> edges, so staging them needs no further
+   reallocation */
+void gt_scaffolder_graph_builder_reserve_edges(GtScaffolderGraphBuilder
+                                               *builder,
+                                               GtUword nof_edges);
+
+/* Link staged edges <edge_1> and <edge_2>, which connect the same vertices in
+   opposite directions, as twins of each other */
+void gt_scaffolder_graph_builder_link_twins(GtScaffolderGraphBuilder *builder,
+                                            GtUword edge_1,
+                                            GtUword edge_2);
+
+/* Returns id of the first staged edge from <vertex_1> to <vertex_2>,
+   GT_UNDEF_UWORD if there is none. The edge is looked up in constant
+   expected time regardless of the degree of <vertex_1>. */
+GtUword
+gt_scaffolder_graph_builder_find_edge(const GtScaffolderGraphBuilder *builder,
+                                      GtUword vertex_1,
+                                      GtUword vertex_2);
+
+/* assign staged edge <edge> new attributes */
+void gt_scaffolder_graph_builder_alter_edge(GtScaffolderGraphBuilder *builder,
+                                            GtUword edge,
+                                            GtWord dist,
+                                            float std_dev,
+                                            GtUword num_pairs,
+                                            bool sense,
+                                            bool same);
+
+/* Move the staged edges of <*builder> into the compressed sparse row layout of
+   its graph, which needs at least one vertex and one edge. The edges of every
+   vertex keep the order in which they were staged. Returns the graph, which
+   is no longer owned by <*builder>. */
+GtScaffolderGraph *
+gt_scaffolder_graph_builder_finalize(GtScaffolderGraphBuilder *builder);
 
 /* print graphrepresentation in dot-format into file filename */
 int gt_scaffolder_graph_print(const GtScaffolderGraph *g,
@@ -154,6 +585,19 @@ int gt_scaffolder_graph_print(const GtScaffolderGraph *g,
 void gt_scaffolder_graph_print_generic(const GtScaffolderGraph *g,
                                        GtFile *f);
 
+struct GtScaffolderParserDistances;
+
+/* create scaffold graph from the contigs of file <ctg_filename> and the
+   records of <*distances>, which are resolved against the contigs (see
+   gt_scaffolder_parser_distances_new) */
+int gt_scaffolder_graph_new_from_distances(GtScaffolderGraph **graph_par,
+                                           const char *ctg_filename,
+                                           GtUword min_ctg_len,
+                                           struct GtScaffolderParserDistances
+                                           *distances,
+                                           bool astat_is_annotated,
+                                           GtError *err);
+
 /* create scaffold graph from file */
 int gt_scaffolder_graph_new_from_file(GtScaffolderGraph **graph_par,
                                       const char *ctg_filename,
@@ -162,6 +606,53 @@ int gt_scaffolder_graph_new_from_file(GtScaffolderGraph **graph_par,
                                       bool astat_is_annotated,
                                       GtError *err);
 
+/* input a scaffold graph was built from, stored in its snapshot file to
+   recognize snapshots of other input */
+typedef struct {
+  GtUword contig_size,
+          contig_mtime,
+          contig_mtime_nsec,
+          distances_size,
+          distances_mtime,
+          distances_mtime_nsec,
+          renumbered;
+} GtScaffolderGraphSnapshotSource;
+
+/* describe in <*source> the graph built from the contig file <ctg_filename>
+   and the DistEst file <dist_filename> by their sizes and modification
+   times, <renumbered> tells whether its vertices were renumbered */
+int gt_scaffolder_graph_snapshot_source_init(GtScaffolderGraphSnapshotSource
+                                             *source,
+                                             const char *ctg_filename,
+                                             const char *dist_filename,
+                                             bool renumbered,
+                                             GtError *err);
+
+/* returns true if <*source_a> and <*source_b> describe the same input */
+bool gt_scaffolder_graph_snapshot_source_equal(const
+                                               GtScaffolderGraphSnapshotSource
+                                               *source_a,
+                                               const
+                                               GtScaffolderGraphSnapshotSource
+                                               *source_b);
+
+/* write <*graph> including all vertex and edge states and the description
+   <*source> of its input into the binary snapshot file <filename> */
+int gt_scaffolder_graph_save(const GtScaffolderGraph *graph,
+                             const char *filename,
+                             const GtScaffolderGraphSnapshotSource *source,
+                             GtError *err);
+
+/* create scaffold graph <**graph_par> from binary snapshot file <filename>
+   written by gt_scaffolder_graph_save and store the description of its input
+   in <*source>. The file is mapped into memory, changes of the graph are
+   private and do not alter the file. No vertices or edges can be added to
+   the loaded graph. */
+int gt_scaffolder_graph_load(GtScaffolderGraph **graph_par,
+                             const char *filename,
+                             GtScaffolderGraphSnapshotSource *source,
+                             GtError *err);
+
 /* Function to test basic graph functionality on different scenarios:
 - Create graph and allocate space for <max_nof_vertices> vertices and
   <max_nof_edges> edges.
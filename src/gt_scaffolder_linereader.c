@@ -0,0 +1,124 @@
+/*
+  Copyright (c) 2015 Dorle Osterode, Stefan Dang, Lukas Götz
+  Copyright (c) 2015 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include <string.h>
+
+#include "core/assert_api.h"
+#include "core/ma_api.h"
+#include "core/xansi_api.h"
+
+#include "gt_scaffolder_linereader.h"
+
+/* size of the chunks read at once */
+#define GT_SCAFFOLDER_LINE_READER_CHUNK_SIZE (64 * 1024)
+
+/* open file <filename> for reading line by line, returns NULL if it can not
+   be read */
+GtScaffolderLineReader *gt_scaffolder_line_reader_new(const char *filename)
+{
+  GtScaffolderLineReader *reader;
+  FILE *file;
+
+  file = fopen(filename, "rb");
+  if (file == NULL)
+    return NULL;
+
+  reader = gt_malloc(sizeof (*reader));
+  reader->file = file;
+  reader->buffer_size = GT_SCAFFOLDER_LINE_READER_CHUNK_SIZE;
+  reader->buffer = gt_malloc(sizeof (*reader->buffer) * reader->buffer_size);
+  reader->start = 0;
+  reader->end = 0;
+  reader->scan = 0;
+  reader->eof = false;
+
+  return reader;
+}
+
+/* delete <*reader> and close its file */
+void gt_scaffolder_line_reader_delete(GtScaffolderLineReader *reader)
+{
+  if (reader == NULL)
+    return;
+  fclose(reader->file);
+  gt_free(reader->buffer);
+  gt_free(reader);
+}
+
+/* move the unread data of <*reader> to the front of its buffer, enlarge the
+   buffer if it is still full and append the next chunk of the file */
+static void gt_scaffolder_line_reader_fill(GtScaffolderLineReader *reader)
+{
+  GtUword nof_read;
+
+  if (reader->start > 0) {
+    memmove(reader->buffer, reader->buffer + reader->start,
+            reader->end - reader->start);
+    reader->end -= reader->start;
+    reader->scan -= reader->start;
+    reader->start = 0;
+  }
+  /* one byte stays free for the terminator of the last line */
+  if (reader->end + 1 >= reader->buffer_size) {
+    reader->buffer_size *= 2;
+    reader->buffer = gt_realloc(reader->buffer, sizeof (*reader->buffer) *
+                                reader->buffer_size);
+  }
+  nof_read = gt_xfread(reader->buffer + reader->end, 1,
+                       reader->buffer_size - reader->end - 1, reader->file);
+  if (nof_read == 0)
+    reader->eof = true;
+  reader->end += nof_read;
+}
+
+/* store the next line of <*reader> without its newline in <*line> and its
+   length in <*line_len>. The line is null terminated and valid until the
+   next call. Returns false at the end of the file. */
+bool gt_scaffolder_line_reader_next(GtScaffolderLineReader *reader,
+                                    char **line,
+                                    GtUword *line_len)
+{
+  char *newline;
+
+  gt_assert(reader != NULL);
+
+  for (;;) {
+    newline = memchr(reader->buffer + reader->scan, '\n',
+                     reader->end - reader->scan);
+    if (newline != NULL) {
+      *newline = '\0';
+      *line = reader->buffer + reader->start;
+      *line_len = newline - *line;
+      reader->start = newline - reader->buffer + 1;
+      reader->scan = reader->start;
+      return true;
+    }
+    reader->scan = reader->end;
+    if (reader->eof)
+      break;
+    gt_scaffolder_line_reader_fill(reader);
+  }
+
+  /* last line without newline */
+  if (reader->start == reader->end)
+    return false;
+  reader->buffer[reader->end] = '\0';
+  *line = reader->buffer + reader->start;
+  *line_len = reader->end - reader->start;
+  reader->start = reader->end;
+  return true;
+}
@@ -0,0 +1,55 @@
+/*
+  Copyright (c) 2015 Dorle Osterode, Stefan Dang, Lukas Götz
+  Copyright (c) 2015 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef GT_SCAFFOLDER_LINEREADER_H
+#define GT_SCAFFOLDER_LINEREADER_H
+
+#include <stdbool.h>
+#include <stdio.h>
+
+#include "core/types_api.h"
+
+/* Reads a text file in chunks into one buffer and hands out its lines
+   without copying them. Lines of any length are supported, the buffer only
+   grows if a line does not fit into it. */
+typedef struct GtScaffolderLineReader {
+  FILE *file;
+  char *buffer;
+  GtUword buffer_size;
+  /* unread data occupies buffer[start] to buffer[end - 1], bytes before
+     <scan> contain no newline */
+  GtUword start;
+  GtUword end;
+  GtUword scan;
+  bool eof;
+} GtScaffolderLineReader;
+
+/* open file <filename> for reading line by line, returns NULL if it can not
+   be read */
+GtScaffolderLineReader *gt_scaffolder_line_reader_new(const char *filename);
+
+/* delete <*reader> and close its file */
+void gt_scaffolder_line_reader_delete(GtScaffolderLineReader *reader);
+
+/* store the next line of <*reader> without its newline in <*line> and its
+   length in <*line_len>. The line is null terminated and valid until the
+   next call. Returns false at the end of the file. */
+bool gt_scaffolder_line_reader_next(GtScaffolderLineReader *reader,
+                                    char **line,
+                                    GtUword *line_len);
+
+#endif
@@ -15,15 +15,30 @@
   OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
 */
 
+#include <errno.h>
+#include <fcntl.h>
+#include <limits.h>
 #include <stdbool.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
-
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
+
+#include "core/assert_api.h"
 #include "core/fasta_reader_rec.h"
 #include "core/ma_api.h"
+#include "core/minmax.h"
 #include "core/cstr_api.h"
+#include "core/thread_api.h"
+#include "core/undef_api.h"
+#include "core/xposix.h"
 
+#include "gt_scaffolder_catalog.h"
 #include "gt_scaffolder_graph.h"
 #include "gt_scaffolder_parser.h"
 
@@ -32,23 +47,340 @@ const GtUword BUFSIZE = 1024;
 /* for parsing valid contigs,
    e.g. contigs with minimum length <min_ctg_len> */
 typedef struct {
-  GtUword nof_valid_ctg;
+  GtUword nof_ctg;
   GtUword min_ctg_len;
   GtStr *header_seq;
-  GtScaffolderGraph *graph;
+  GtScaffolderGraphBuilder *builder;
   bool astat_is_annotated;
   float astat;
   float copynum;
 } GtScaffolderGraphFastaReaderData;
 
-/* sort by lexicographic ascending order */
-static int gt_scaffolder_graph_vertices_compare(const void *a, const void *b)
+/* cursor over the lines and space delimited tokens of a mapped DistEst
+   file */
+typedef struct {
+  const char *pos;
+  const char *end;
+  bool in_line;
+} GtScaffolderParserTokenizer;
+
+/* exact powers of ten in single precision */
+static const float gt_scaffolder_parser_powers_of_ten[] = {
+  1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f
+};
+
+/* returns the first byte from <pos> to <end> which equals <delim_1> or
+   <delim_2>, <end> if there is none. With SSE2 16 bytes are compared at
+   once. */
+static const char *gt_scaffolder_parser_find_delimiter(const char *pos,
+                                                       const char *end,
+                                                       char delim_1,
+                                                       char delim_2)
+{
+#ifdef __SSE2__
+  const __m128i delims_1 = _mm_set1_epi8(delim_1),
+                delims_2 = _mm_set1_epi8(delim_2);
+  __m128i block;
+  int mask;
+
+  /* unaligned loads which never read behind <end> */
+  while (end - pos >= (GtWord) sizeof (block)) {
+    block = _mm_loadu_si128((const __m128i *) pos);
+    mask = _mm_movemask_epi8(_mm_or_si128(_mm_cmpeq_epi8(block, delims_1),
+                                          _mm_cmpeq_epi8(block, delims_2)));
+    if (mask != 0)
+      return pos + __builtin_ctz(mask);
+    pos += sizeof (block);
+  }
+#endif
+  while (pos < end && *pos != delim_1 && *pos != delim_2)
+    pos++;
+  return pos;
+}
+
+/* start <*tokenizer> at the first line of <mapping> of <size> bytes */
+static void gt_scaffolder_parser_tokenizer_init(GtScaffolderParserTokenizer
+                                                *tokenizer,
+                                                const char *mapping,
+                                                GtUword size)
+{
+  tokenizer->pos = mapping;
+  tokenizer->end = mapping + size;
+  tokenizer->in_line = false;
+}
+
+/* store the next space delimited token of the current line of <*tokenizer>
+   and its length in <*token> and <*token_len>. Returns false at the end of
+   the line. */
+static bool gt_scaffolder_parser_next_token(GtScaffolderParserTokenizer
+                                            *tokenizer,
+                                            const char **token,
+                                            GtUword *token_len)
+{
+  while (tokenizer->in_line) {
+    if (tokenizer->pos == tokenizer->end)
+      tokenizer->in_line = false;
+    else if (*tokenizer->pos == '\n') {
+      tokenizer->pos++;
+      tokenizer->in_line = false;
+    }
+    else if (*tokenizer->pos == ' ')
+      tokenizer->pos++;
+    else {
+      *token = tokenizer->pos;
+      tokenizer->pos = gt_scaffolder_parser_find_delimiter(tokenizer->pos,
+                       tokenizer->end, ' ', '\n');
+      *token_len = tokenizer->pos - *token;
+      return true;
+    }
+  }
+  return false;
+}
+
+/* skip the rest of the current line of <*tokenizer>. Returns false if there
+   is no further line. */
+static bool gt_scaffolder_parser_next_line(GtScaffolderParserTokenizer
+                                           *tokenizer)
+{
+  const char *token;
+  GtUword token_len;
+
+  while (gt_scaffolder_parser_next_token(tokenizer, &token, &token_len))
+    /* nothing */;
+  if (tokenizer->pos == tokenizer->end)
+    return false;
+  tokenizer->in_line = true;
+  return true;
+}
+
+/* parse the signed integer at <*pos> before <end> into <*value> and advance
+   <*pos> behind it. Returns false if there is no digit or the integer does
+   not fit into a GtWord. */
+static bool gt_scaffolder_parser_parse_word(const char **pos,
+                                            const char *end,
+                                            GtWord *value)
+{
+  const char *p = *pos;
+  bool negative = false;
+  GtWord v = 0, digit;
+
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    p++;
+  }
+  if (p == end || *p < '0' || *p > '9')
+    return false;
+  while (p < end && *p >= '0' && *p <= '9') {
+    digit = *p - '0';
+    if (v > (GT_WORD_MAX - digit) / 10)
+      return false;
+    v = 10 * v + digit;
+    p++;
+  }
+  *value = negative ? -v : v;
+  *pos = p;
+  return true;
+}
+
+/* parse the floating point number at <pos> before <end> into <*value>.
+   Returns false if there is none. Decimal fractions with at most 7
+   significant digits are computed as one correctly rounded division of
+   exact single precision numbers, which yields the same value as strtof, any
+   other form is left to strtof. */
+static bool gt_scaffolder_parser_parse_float(const char *pos,
+                                             const char *end,
+                                             float *value)
+{
+  const char *p = pos;
+  char short_number[BUFSIZE+1], *number, *number_end;
+  GtUword mantissa = 0, nof_digits = 0, nof_fraction_digits = 0, len;
+  bool negative = false, fraction = false, valid;
+
+  if (p < end && (*p == '-' || *p == '+')) {
+    negative = *p == '-';
+    p++;
+  }
+  for (; p < end; p++) {
+    if (*p >= '0' && *p <= '9') {
+      mantissa = 10 * mantissa + (*p - '0');
+      nof_digits++;
+      if (fraction)
+        nof_fraction_digits++;
+    }
+    else if (*p == '.' && !fraction)
+      fraction = true;
+    else
+      break;
+  }
+
+  if (nof_digits > 0 && nof_digits <= 7 &&
+      (p == end || (*p != 'e' && *p != 'E' && *p != 'x' && *p != 'X'))) {
+    *value = (float) mantissa /
+             gt_scaffolder_parser_powers_of_ten[nof_fraction_digits];
+    if (negative)
+      *value = -*value;
+    return true;
+  }
+
+  /* the mapping is not null terminated, so the number is converted from a
+     copy of the rest of the token, which only long tokens allocate */
+  len = end - pos;
+  number = len <= BUFSIZE ? short_number
+                          : gt_malloc(sizeof (*number) * (len + 1));
+  memcpy(number, pos, len);
+  number[len] = '\0';
+  *value = strtof(number, &number_end);
+  valid = number_end != number;
+  if (number != short_number)
+    gt_free(number);
+  return valid;
+}
+
+/* parse record <token> of length <token_len> consisting of contig header
+   with composition sign, distance, number of pairs and std. dev. into
+   <*record>, as sscanf with format "%[^>,],%ld,%ld,%f" would. The header is
+   stored as offset <offset> of <token> and its length. Returns false if
+   <token> is no such record. */
+static bool gt_scaffolder_parser_parse_record(const char *token,
+                                              GtUword token_len,
+                                              GtUword offset,
+                                              GtScaffolderParserDistance
+                                              *record)
+{
+  const char *pos, *end;
+  GtUword header_len;
+
+  end = token + token_len;
+  pos = gt_scaffolder_parser_find_delimiter(token, end, ',', '>');
+  header_len = pos - token;
+  /* the header is only limited by the width of its stored length */
+  if (header_len == 0 || header_len > UINT_MAX || pos == end || *pos != ',')
+    return false;
+  pos++;
+  if (!gt_scaffolder_parser_parse_word(&pos, end, &record->dist) ||
+      pos == end || *pos != ',')
+    return false;
+  pos++;
+  if (!gt_scaffolder_parser_parse_word(&pos, end, &record->num_pairs) ||
+      pos == end || *pos != ',')
+    return false;
+  pos++;
+  if (!gt_scaffolder_parser_parse_float(pos, end, &record->std_dev))
+    return false;
+
+  record->target = offset;
+  record->target_len = header_len;
+  return true;
+}
+
+/* size of the blocks in which a DistEst file that can not be mapped is
+   read */
+#define GT_SCAFFOLDER_PARSER_READ_BLOCK (64 * 1024)
+
+/* read the rest of the stream <fd> into the buffer <*mapping> of <*size>
+   bytes, for pipes and other files that can not be mapped */
+static int gt_scaffolder_parser_read_stream(int fd,
+                                            const char *filename,
+                                            char **mapping,
+                                            GtUword *size,
+                                            GtError *err)
+{
+  GtUword buffer_size = 0;
+  ssize_t nof_bytes;
+
+  do {
+    if (*size + GT_SCAFFOLDER_PARSER_READ_BLOCK > buffer_size) {
+      buffer_size = MAX(2 * buffer_size, GT_SCAFFOLDER_PARSER_READ_BLOCK);
+      *mapping = gt_realloc(*mapping, sizeof (**mapping) * buffer_size);
+    }
+    nof_bytes = read(fd, *mapping + *size, GT_SCAFFOLDER_PARSER_READ_BLOCK);
+    if (nof_bytes > 0)
+      *size += nof_bytes;
+  } while (nof_bytes > 0 || (nof_bytes == -1 && errno == EINTR));
+
+  if (nof_bytes == -1) {
+    gt_error_set(err, "can not read distance file %s", filename);
+    return -1;
+  }
+  return 0;
+}
+
+/* map file <filename> read-only into <*mapping> of <*size> bytes, an empty
+   file is not mapped. Files that can not be mapped, like pipes, are read
+   into memory instead and <*mapped> is set to false. */
+static int gt_scaffolder_parser_map_file(const char *filename,
+                                         char **mapping,
+                                         GtUword *size,
+                                         bool *mapped,
+                                         GtError *err)
+{
+  struct stat sb;
+  int fd, had_err = 0;
+
+  *mapping = NULL;
+  *size = 0;
+  *mapped = true;
+
+  fd = open(filename, O_RDONLY);
+  if (fd == -1) {
+    had_err = -1;
+    gt_error_set(err, "can not read distance file %s", filename);
+  }
+
+  if (had_err == 0) {
+    gt_xfstat(fd, &sb);
+    if (!S_ISREG(sb.st_mode)) {
+      *mapped = false;
+      had_err = gt_scaffolder_parser_read_stream(fd, filename, mapping, size,
+                                                 err);
+    }
+    else if (sb.st_size > 0) {
+      *size = sb.st_size;
+      *mapping = gt_xmmap(NULL, (size_t) sb.st_size, PROT_READ, MAP_PRIVATE,
+                          fd, 0);
+    }
+    close(fd);
+  }
+
+  return had_err;
+}
+
+/* release <mapping> of <size> bytes created by
+   gt_scaffolder_parser_map_file */
+static void gt_scaffolder_parser_unmap_file(char *mapping,
+                                            GtUword size,
+                                            bool mapped)
 {
-  GtScaffolderGraphVertex *vertex_a =
-  (GtScaffolderGraphVertex*) a;
-  GtScaffolderGraphVertex *vertex_b =
-  (GtScaffolderGraphVertex*) b;
-  return gt_str_cmp(vertex_a->header_seq, vertex_b->header_seq);
+  if (!mapped)
+    gt_free(mapping);
+  else if (mapping != NULL)
+    gt_xmunmap(mapping, size);
+}
+
+/* returns true if sscanf with format "%[^>,],%ld,%ld,%f" yields the same
+   values for record <token> of length <token_len> as
+   gt_scaffolder_parser_parse_record stored in <*record> */
+static bool
+gt_scaffolder_parser_record_matches_sscanf(const char *token,
+                                           GtUword token_len,
+                                           const GtScaffolderParserDistance
+                                           *record)
+{
+  GtWord dist, num_pairs;
+  float std_dev;
+  char *copy;
+  bool matches;
+
+  copy = gt_malloc(sizeof (*copy) * (token_len + 1));
+  memcpy(copy, token, token_len);
+  copy[token_len] = '\0';
+  matches = sscanf(copy, "%*[^>,]," GT_WD "," GT_WD ",%f", &dist,
+                   &num_pairs, &std_dev) == 3 &&
+            dist == record->dist && num_pairs == record->num_pairs &&
+            memcmp(&std_dev, &record->std_dev, sizeof (std_dev)) == 0;
+  gt_free(copy);
+
+  return matches;
 }
 
 /* test parsing distance records */
@@ -56,21 +388,17 @@ int gt_scaffolder_parser_read_distances_test(const char *filename,
                                              char *output_filename,
                                              GtError *err)
 {
-  FILE *file;
-  GtFile *f;
-  char line[BUFSIZE+1], *field, ctg_header[BUFSIZE+1], sign;
-  GtUword ctg_header_len;
-  GtWord dist, num_pairs;
-  float std_dev;
-  bool same, sense, first_antisense;
+  GtScaffolderParserTokenizer tokenizer;
+  GtScaffolderParserDistance record;
+  GtFile *f = NULL;
+  char *mapping, sign;
+  const char *token;
+  GtUword mapping_size, token_len;
+  bool sense, first_antisense, mapped;
   int had_err;
 
-  had_err = 0;
-  file = fopen(filename, "rb");
-  if (file == NULL) {
-    had_err = -1;
-    gt_error_set(err, "can not read distance file %s",filename);
-  }
+  had_err = gt_scaffolder_parser_map_file(filename, &mapping, &mapping_size,
+                                          &mapped, err);
 
   if (had_err != -1) {
     f = gt_file_new(output_filename, "w", err);
@@ -81,54 +409,54 @@ int gt_scaffolder_parser_read_distances_test(const char *filename,
   if (had_err != -1)
   {
     /* iterate over each line of file until eof (contig record) */
-    while (fgets(line, BUFSIZE, file) != NULL)
+    gt_scaffolder_parser_tokenizer_init(&tokenizer, mapping, mapping_size);
+    while (gt_scaffolder_parser_next_line(&tokenizer))
     {
-      line[strlen(line)-1] = '\0';
       sense = true;
-      field = strtok(line," ");
+      first_antisense = true;
 
       /* write parsed distance information to file */
-      gt_file_xprintf(f, "%s", field);
-      first_antisense = true;
+      if (gt_scaffolder_parser_next_token(&tokenizer, &token, &token_len))
+        gt_file_xprintf(f, "%.*s", (int) token_len, token);
 
       /* iterate over space delimited records */
-      while (field != NULL)
+      while (gt_scaffolder_parser_next_token(&tokenizer, &token, &token_len))
       {
         /* parse record consisting of contig header, distance,
            number of pairs, std. dev. */
-        if (sscanf(field,"%[^>,]," GT_WD "," GT_WD ",%f", ctg_header, &dist,
-            &num_pairs, &std_dev) == 4)
+        if (gt_scaffolder_parser_parse_record(token, token_len, 0, &record))
         {
-          if (num_pairs < 0) {
+          /* the numbers are parsed by hand, they have to be identical to
+             those of sscanf */
+          if (!gt_scaffolder_parser_record_matches_sscanf(token, token_len,
+                                                          &record)) {
+            had_err = -1;
+            gt_error_set(err, "record %.*s is parsed differently by sscanf",
+                         (int) token_len, token);
+            break;
+          }
+          if (record.num_pairs < 0) {
             had_err = -1;
             gt_error_set(err, "Invalid value for number of pairs");
             break;
           }
 
           /* parsing composition,
-           '+' indicates same strand and '-' reverse strand */
-          ctg_header_len = strlen(ctg_header);
-          same = ctg_header[ctg_header_len - 1] == '+' ? true : false;
-
-          /* cut composition sign */
-          ctg_header[ctg_header_len - 1] = '\0';
-
-          /* write parsed distance information to file */
-          sign = same == true ? '+' : '-';
-          gt_file_xprintf(f, " %s%c," GT_WD "," GT_WD ",%.1f", ctg_header,
-                  sign, dist, num_pairs, std_dev);
+           '+' indicates same strand and '-' reverse strand, write parsed
+           distance information to file without the sign */
+          sign = token[record.target_len - 1] == '+' ? '+' : '-';
+          gt_file_xprintf(f, " %.*s%c," GT_WD "," GT_WD ",%.1f",
+                          (int) record.target_len - 1, token, sign,
+                          record.dist, record.num_pairs, record.std_dev);
         }
         /* switch direction */
-        else if (*field == ';')
+        else if (*token == ';')
           sense = sense ? false : true;
 
-        field = strtok(NULL," ");
-
         if (!sense && first_antisense) {
           gt_file_xprintf(f, " ;");
           first_antisense = false;
         }
-
       }
       if (had_err == -1)
         break;
@@ -139,278 +467,526 @@ int gt_scaffolder_parser_read_distances_test(const char *filename,
     }
   }
 
-  if (file != NULL)
-    gt_file_delete(f);
-
-  fclose(file);
+  gt_file_delete(f);
+  gt_scaffolder_parser_unmap_file(mapping, mapping_size, mapped);
   return had_err;
 }
 
-/* count records and check integrity of abyss-dist-format */
-int gt_scaffolder_parser_count_distances(const GtScaffolderGraph *graph,
-                                               const char *file_name,
-                                               GtUword *nof_distances,
-                                               GtError *err)
-{
-  FILE *file;
-  char line[BUFSIZE+1], *field, ctg_header[BUFSIZE+1], comp_sign;
-  GtUword record_counter, *edge_counter,
-          line_record_counter;
-  GtWord dist, num_pairs;
-  float std_dev;
+/* minimal number of bytes of the DistEst file tokenized by one thread, and
+   of records resolved by one thread */
+#define GT_SCAFFOLDER_PARSER_MIN_CHUNK_SIZE    (1024 * 1024)
+#define GT_SCAFFOLDER_PARSER_MIN_CHUNK_RECORDS (16 * 1024)
+/* number of chunks per thread, more chunks balance the load better */
+#define GT_SCAFFOLDER_PARSER_CHUNKS_PER_THREAD 4
+
+/* part of a DistEst file or of its records processed by one thread */
+typedef struct {
+  /* bytes of the mapping when tokenizing, records when resolving */
+  GtUword start;
+  GtUword end;
+  /* records of the chunk, tokenizing stores them in a buffer of its own */
+  GtScaffolderParserDistance *records;
+  GtUword nof_records;
+  GtUword max_nof_records;
+  GtError *err;
   int had_err;
-  bool valid_contig;
-  GtStr *gt_str_field;
-  GtScaffolderGraphVertex *v, *ctg, *root_ctg;
-  GtScaffolderGraphEdge *edge;
+} GtScaffolderParserChunk;
 
-  had_err = 0;
-  record_counter = 0;
-  gt_str_field = gt_str_new();
+/* data shared by all threads processing the chunks of a DistEst file */
+typedef struct {
+  GtScaffolderParserDistances *distances;
+  /* graph the records are resolved against, NULL when tokenizing */
+  const GtScaffolderGraph *graph;
+  GtScaffolderParserChunk *chunks;
+  GtUword nof_chunks;
+  GtUword next_chunk;
+  GtMutex *mutex;
+} GtScaffolderParserJobs;
+
+/* returns number of chunks of at least <min_chunk_size> units <size> units
+   are split into, so that every thread gets some of them */
+static GtUword gt_scaffolder_parser_nof_chunks(GtUword size,
+                                               GtUword min_chunk_size)
+{
+  GtUword nof_chunks;
 
-  /* sort by lexicographic ascending order */
-  qsort(graph->vertices, graph->nof_vertices, sizeof (*graph->vertices),
-       gt_scaffolder_graph_vertices_compare);
+  if (gt_jobs <= 1)
+    return 1;
+  nof_chunks = MIN((GtUword) gt_jobs * GT_SCAFFOLDER_PARSER_CHUNKS_PER_THREAD,
+                   size / min_chunk_size);
+  return MAX(nof_chunks, 1);
+}
 
-  file = fopen(file_name, "rb");
-  if (file == NULL) {
-    had_err = -1;
-    gt_error_set(err, "can not read distance file %s",file_name);
+/* append <*record> to the records of <*chunk> */
+static void gt_scaffolder_parser_chunk_add(GtScaffolderParserChunk *chunk,
+                                           const GtScaffolderParserDistance
+                                           *record)
+{
+  if (chunk->nof_records == chunk->max_nof_records) {
+    chunk->max_nof_records = MAX(2 * chunk->max_nof_records, BUFSIZE);
+    chunk->records = gt_realloc(chunk->records, sizeof (*chunk->records) *
+                                chunk->max_nof_records);
   }
+  chunk->records[chunk->nof_records++] = *record;
+}
 
-  edge_counter = gt_calloc(graph->nof_vertices, sizeof (*edge_counter));
+/* tokenize every line of <*chunk> of the mapped DistEst file of
+   <*distances> once and store its records in <*chunk> */
+static int gt_scaffolder_parser_tokenize_chunk(const
+                                               GtScaffolderParserDistances
+                                               *distances,
+                                               GtScaffolderParserChunk *chunk)
+{
+  GtScaffolderParserTokenizer tokenizer;
+  GtScaffolderParserDistance record;
+  GtError *err = chunk->err;
+  const char *token;
+  GtUword token_len;
+  char comp_sign;
+  bool sense, has_root;
+  int had_err = 0;
+
+  gt_scaffolder_parser_tokenizer_init(&tokenizer,
+                                      distances->mapping + chunk->start,
+                                      chunk->end - chunk->start);
+
+  /* iterate over each line of file until eof (contig record) */
+  while (had_err == 0 && gt_scaffolder_parser_next_line(&tokenizer)) {
+    /* root contig header */
+    has_root = gt_scaffolder_parser_next_token(&tokenizer, &token,
+                                               &token_len) &&
+               token_len <= UINT_MAX;
+    if (has_root) {
+      record.root = token - distances->mapping;
+      record.root_len = token_len;
+    }
 
-  if (had_err != -1)
-  {
-    /* iterate over each line of file until eof (contig record) */
-    while (fgets(line, BUFSIZE, file) != NULL)
-    {
-      field = strtok(line," ");
+    /* if no records exist */
+    if (!has_root ||
+        !gt_scaffolder_parser_next_token(&tokenizer, &token, &token_len)) {
+      had_err = -1;
+      gt_error_set(err, "Invalid record in dist file %s",
+                   distances->filename);
+      break;
+    }
 
-      gt_str_set(gt_str_field, field);
-      valid_contig = gt_scaffolder_graph_get_vertex(graph, &root_ctg,
-                gt_str_field);
+    /* iterate over space delimited records */
+    sense = true;
+    do {
+      if (gt_scaffolder_parser_parse_record(token, token_len,
+                                            token - distances->mapping,
+                                            &record)) {
+        /* detect invalid records */
+        if (record.num_pairs < 0) {
+          had_err = -1;
+          gt_error_set(err, "Invalid value for number of pairs in dist "
+                            "file %s", distances->filename);
+          break;
+        }
 
-      field = strtok(NULL," ");
+        /* parsing composition,
+           '+' indicates same strand and '-' reverse strand */
+        comp_sign = token[record.target_len - 1];
+        if (comp_sign != '+' && comp_sign != '-') {
+          had_err = -1;
+          gt_error_set(err, "Invalid composition sign in dist file %s",
+                       distances->filename);
+          break;
+        }
+        record.same = comp_sign == '+';
+        record.sense = sense;
 
-      /* if no records exist */
-      if (field == NULL) {
+        /* cut composition sign */
+        record.target_len--;
+        gt_scaffolder_parser_chunk_add(chunk, &record);
+      }
+      /* switch direction */
+      else if (*token == ';')
+        sense = sense ? false : true;
+      /* detect invalid record */
+      else {
         had_err = -1;
         gt_error_set(err, "Invalid record in dist file %s",
-                           file_name);
+                     distances->filename);
         break;
       }
+    } while (gt_scaffolder_parser_next_token(&tokenizer, &token, &token_len));
+  }
 
-      if (valid_contig) {
+  return had_err;
+}
 
-        line_record_counter = 0;
+/* replace the contig headers of the records of <*chunk> of <*distances> by
+   vertex ids of <*graph> and move the records of contigs in <*graph> to the
+   front of the chunk */
+static void gt_scaffolder_parser_resolve_chunk(GtScaffolderParserDistances
+                                               *distances,
+                                               const GtScaffolderGraph *graph,
+                                               GtScaffolderParserChunk *chunk)
+{
+  GtScaffolderParserDistance *record;
+  GtUword rid, root_offset, root_ctg, ctg;
+  bool valid_root;
+
+  chunk->nof_records = 0;
+  root_offset = GT_UNDEF_UWORD;
+  root_ctg = GT_UNDEF_UWORD;
+  valid_root = false;
+  for (rid = chunk->start; rid < chunk->end; rid++) {
+    record = distances->records + rid;
+
+    /* the records of a line share their root contig */
+    if (record->root != root_offset) {
+      root_offset = record->root;
+      valid_root = gt_scaffolder_graph_get_vertex(graph, &root_ctg,
+                   distances->mapping + record->root, record->root_len);
+    }
+    if (valid_root &&
+        gt_scaffolder_graph_get_vertex(graph, &ctg,
+                                       distances->mapping + record->target,
+                                       record->target_len)) {
+      record->root = root_ctg;
+      record->target = ctg;
+      distances->records[chunk->start + chunk->nof_records++] = *record;
+    }
+  }
+}
 
-        /* iterate over space delimited records */
-        while (field != NULL)
-        {
-          /* count records */
-          if (sscanf(field,"%[^>,]," GT_WD "," GT_WD ",%f", ctg_header,
-              &dist, &num_pairs, &std_dev) == 4) {
-
-            /* detect invalid records */
-            if (num_pairs < 0) {
-              had_err = -1;
-              gt_error_set(err, "Invalid value for number of pairs in dist "
-                                "file %s", file_name);
-              break;
-            }
-
-            comp_sign = ctg_header[strlen(ctg_header) - 1];
-            if (comp_sign != '+' && comp_sign != '-') {
-              had_err = -1;
-              gt_error_set(err, "Invalid composition sign in dist file %s",
-                                 file_name);
-              break;
-            }
-
-            /* cut composition sign */
-            ctg_header[strlen(ctg_header) - 1] = '\0';
-
-            gt_str_set(gt_str_field, ctg_header);
-            /* get vertex id corresponding to contig header */
-            valid_contig = gt_scaffolder_graph_get_vertex(graph, &ctg,
-                           gt_str_field);
-
-            if (valid_contig) {
-
-              /* check if edge between vertices already exists */
-              edge = gt_scaffolder_graph_find_edge(root_ctg, ctg);
-              if (edge == NULL)
-              {
-                edge_counter[ctg-graph->vertices] += 1;
-                edge_counter[root_ctg-graph->vertices] += 1;
-                line_record_counter += 2;
-              }
-            }
+/* tokenize or resolve chunks until no chunk is left */
+static void *gt_scaffolder_parser_chunk_thread(void *data)
+{
+  GtScaffolderParserJobs *jobs = data;
+  GtScaffolderParserChunk *chunk;
+  GtUword cid;
+
+  while (true) {
+    /* fetch index of next chunk */
+    gt_mutex_lock(jobs->mutex);
+    cid = jobs->next_chunk;
+    if (cid < jobs->nof_chunks)
+      jobs->next_chunk++;
+    gt_mutex_unlock(jobs->mutex);
+    if (cid >= jobs->nof_chunks)
+      break;
+
+    chunk = jobs->chunks + cid;
+    if (jobs->graph == NULL)
+      chunk->had_err = gt_scaffolder_parser_tokenize_chunk(jobs->distances,
+                                                           chunk);
+    else
+      gt_scaffolder_parser_resolve_chunk(jobs->distances, jobs->graph, chunk);
+  }
 
-          }
-          /* detect invalid record */
-          else if (*field != ';') {
-            had_err = -1;
-            gt_error_set(err, "Invalid record in dist file %s",
-                               file_name);
-            break;
-          }
+  return NULL;
+}
 
-          field = strtok(NULL," ");
-        }
-        if (had_err == -1)
-          break;
-        edge_counter[root_ctg-graph->vertices] += line_record_counter;
-        record_counter += line_record_counter;
-      }
+/* process <nof_chunks> chunks of <*distances>, tokenizing them if <*graph>
+   is NULL and resolving them against <*graph> otherwise. The chunks are
+   distributed over <gt_jobs> threads if there is more than one. */
+static int gt_scaffolder_parser_process_chunks(GtScaffolderParserDistances
+                                               *distances,
+                                               const GtScaffolderGraph *graph,
+                                               GtScaffolderParserChunk *chunks,
+                                               GtUword nof_chunks,
+                                               GtError *err)
+{
+  GtScaffolderParserJobs jobs;
+  int had_err;
+
+  jobs.distances = distances;
+  jobs.graph = graph;
+  jobs.chunks = chunks;
+  jobs.nof_chunks = nof_chunks;
+  jobs.next_chunk = 0;
+
+  jobs.mutex = gt_mutex_new();
+
+  /* a single chunk needs no thread of its own */
+  if (nof_chunks == 1) {
+    gt_scaffolder_parser_chunk_thread(&jobs);
+    had_err = 0;
+  }
+  else
+    had_err = gt_multithread(gt_scaffolder_parser_chunk_thread, &jobs, err);
+
+  gt_mutex_delete(jobs.mutex);
+
+  return had_err;
+}
+
+/* split the mapped DistEst file of <*distances> at line boundaries into
+   chunks, tokenize them, in parallel if <gt_jobs> is larger than one, and
+   store their records in file order */
+static int gt_scaffolder_parser_distances_tokenize(GtScaffolderParserDistances
+                                                   *distances,
+                                                   GtError *err)
+{
+  GtScaffolderParserChunk *chunks;
+  const char *newline;
+  GtUword nof_chunks, cid, start;
+  int had_err;
+
+  nof_chunks = gt_scaffolder_parser_nof_chunks(distances->mapping_size,
+               GT_SCAFFOLDER_PARSER_MIN_CHUNK_SIZE);
+  chunks = gt_calloc(nof_chunks, sizeof (*chunks));
+  start = 0;
+  for (cid = 0; cid < nof_chunks; cid++) {
+    chunks[cid].start = start;
+    if (cid == nof_chunks - 1)
+      chunks[cid].end = distances->mapping_size;
+    else {
+      /* every chunk ends behind the newline of its last line */
+      chunks[cid].end = MAX(start, (cid + 1) * (distances->mapping_size /
+                                                nof_chunks));
+      newline = memchr(distances->mapping + chunks[cid].end, '\n',
+                       distances->mapping_size - chunks[cid].end);
+      chunks[cid].end = newline == NULL ? distances->mapping_size
+                                        : newline - distances->mapping + 1;
     }
-    fclose(file);
+    start = chunks[cid].end;
+    chunks[cid].err = gt_error_new();
   }
 
-  if (record_counter == 0) {
-    had_err = -1;
-    gt_error_set(err,"distance file %s is empty", file_name);
+  had_err = gt_scaffolder_parser_process_chunks(distances, NULL, chunks,
+                                                nof_chunks, err);
+
+  /* the error of the first chunk in file order is reported, as if the file
+     had been tokenized sequentially */
+  for (cid = 0; had_err == 0 && cid < nof_chunks; cid++) {
+    if (chunks[cid].had_err != 0) {
+      had_err = -1;
+      gt_error_set(err, "%s", gt_error_get(chunks[cid].err));
+    }
   }
 
-  if (had_err != -1) {
-    /* allocate memory for edges of vertices */
-    for (v = graph->vertices; v < (graph->vertices + graph->nof_vertices);
-         v++) {
-      if (edge_counter[gt_scaffolder_graph_get_vertex_id(graph, v)] != 0)
-        v->edges = gt_malloc(sizeof (*v->edges) *
-         edge_counter[gt_scaffolder_graph_get_vertex_id(graph, v)]);
+  if (had_err == 0) {
+    if (nof_chunks == 1) {
+      distances->records = chunks[0].records;
+      distances->nof_records = chunks[0].nof_records;
+      distances->max_nof_records = chunks[0].max_nof_records;
+      chunks[0].records = NULL;
+    }
+    else {
+      for (cid = 0; cid < nof_chunks; cid++)
+        distances->nof_records += chunks[cid].nof_records;
+      distances->max_nof_records = distances->nof_records;
+      distances->records = gt_malloc(sizeof (*distances->records) *
+                                     MAX(distances->nof_records, 1));
+      start = 0;
+      for (cid = 0; cid < nof_chunks; cid++) {
+        /* chunks without records have no buffer */
+        if (chunks[cid].nof_records > 0)
+          memcpy(distances->records + start, chunks[cid].records,
+                 sizeof (*distances->records) * chunks[cid].nof_records);
+        start += chunks[cid].nof_records;
+      }
     }
-    *nof_distances = record_counter;
   }
 
-  gt_free(edge_counter);
-  gt_str_delete(gt_str_field);
+  for (cid = 0; cid < nof_chunks; cid++) {
+    gt_free(chunks[cid].records);
+    gt_error_delete(chunks[cid].err);
+  }
+  gt_free(chunks);
+
+  if (had_err == 0 && distances->nof_records == 0) {
+    had_err = -1;
+    gt_error_set(err, "distance file %s is empty", distances->filename);
+  }
 
   return had_err;
 }
 
-/* parse distance information of contigs in abyss-dist-format and
-   save them as edges of scaffold graph */
-int gt_scaffolder_parser_read_distances(const char *filename,
-                                              GtScaffolderGraph *graph,
-                                              bool ismatepair,
-                                              GtError *err)
+/* map the DistEst file <filename>, check integrity of abyss-dist-format and
+   store all its records in <*distances_par>. The file is split at line
+   boundaries into chunks, which are tokenized in parallel if <gt_jobs> is
+   larger than one, the records keep the order of the file. */
+int gt_scaffolder_parser_distances_new(GtScaffolderParserDistances
+                                       **distances_par,
+                                       const char *filename,
+                                       GtError *err)
 {
-  FILE *file;
-  char line[BUFSIZE+1], *field, ctg_header[BUFSIZE+1];
-  GtUword ctg_header_len;
-  GtWord dist, num_pairs;
-  float std_dev;
-  bool same, sense, valid_contig, twin_dir;
-  GtScaffolderGraphEdge *edge;
-  GtScaffolderGraphVertex *root_ctg, *ctg;
+  GtScaffolderParserDistances *distances;
   int had_err;
-  GtStr *gt_str_field;
 
-  had_err = 0;
-  gt_str_field = gt_str_new();
+  distances = gt_malloc(sizeof (*distances));
+  distances->records = NULL;
+  distances->nof_records = 0;
+  distances->max_nof_records = 0;
+  distances->filename = gt_cstr_dup(filename);
+
+  had_err = gt_scaffolder_parser_map_file(filename, &distances->mapping,
+                                          &distances->mapping_size,
+                                          &distances->mapped, err);
+  if (had_err == 0)
+    had_err = gt_scaffolder_parser_distances_tokenize(distances, err);
+
+  if (had_err != 0) {
+    gt_scaffolder_parser_distances_delete(distances);
+    distances = NULL;
+  }
+  *distances_par = distances;
 
-  file = fopen(filename, "rb");
-  if (file == NULL) {
-    had_err = -1;
-    gt_error_set(err, " can not read distance file %s ",filename);
+  return had_err;
+}
+/* delete <*distances> */
+void gt_scaffolder_parser_distances_delete(GtScaffolderParserDistances
+                                           *distances)
+{
+  if (distances == NULL)
+    return;
+  gt_scaffolder_parser_unmap_file(distances->mapping,
+                                  distances->mapping_size,
+                                  distances->mapped);
+  gt_free(distances->records);
+  gt_free(distances->filename);
+  gt_free(distances);
+}
+
+/* returns the number of bytes allocated for the records of <*distances>,
+   which are held while the graph is built from them */
+GtUword gt_scaffolder_parser_distances_memory(const
+                                              GtScaffolderParserDistances
+                                              *distances)
+{
+  gt_assert(distances != NULL);
+  return distances->max_nof_records * sizeof (*distances->records);
+}
+
+/* replace the contig headers of all records of <*distances> by vertex ids of
+   <*graph>, drop the records of contigs not in <*graph> and release the
+   mapped file. The records are resolved in parallel if <gt_jobs> is larger
+   than one and keep their order. */
+int gt_scaffolder_parser_distances_resolve(GtScaffolderParserDistances
+                                           *distances,
+                                           const GtScaffolderGraph *graph,
+                                           GtError *err)
+{
+  GtScaffolderParserChunk *chunks;
+  GtUword nof_chunks, cid, nof_resolved;
+  int had_err;
+
+  gt_assert(distances != NULL && graph != NULL);
+  gt_assert(distances->mapping != NULL);
+
+  nof_chunks = gt_scaffolder_parser_nof_chunks(distances->nof_records,
+               GT_SCAFFOLDER_PARSER_MIN_CHUNK_RECORDS);
+  chunks = gt_calloc(nof_chunks, sizeof (*chunks));
+  for (cid = 0; cid < nof_chunks; cid++) {
+    chunks[cid].start = cid * distances->nof_records / nof_chunks;
+    chunks[cid].end = (cid + 1) * distances->nof_records / nof_chunks;
   }
 
-  if (had_err != -1)
-  {
-    /* iterate over each line of file until eof (contig record) */
-    while (fgets(line, BUFSIZE, file) != NULL)
-    {
-      line[strlen(line)-1] = '\0';
-      sense = true;
-      field = strtok(line," ");
+  had_err = gt_scaffolder_parser_process_chunks(distances, graph, chunks,
+                                                nof_chunks, err);
+
+  /* close the gaps left by the dropped records */
+  if (had_err == 0) {
+    nof_resolved = 0;
+    for (cid = 0; cid < nof_chunks; cid++) {
+      memmove(distances->records + nof_resolved,
+              distances->records + chunks[cid].start,
+              sizeof (*distances->records) * chunks[cid].nof_records);
+      nof_resolved += chunks[cid].nof_records;
+    }
+    distances->nof_records = nof_resolved;
 
-      /* get vertex id corresponding to root contig header */
-      gt_str_set(gt_str_field, field);
-      valid_contig = gt_scaffolder_graph_get_vertex(graph, &root_ctg,
-                gt_str_field);
+    gt_scaffolder_parser_unmap_file(distances->mapping,
+                                    distances->mapping_size,
+                                    distances->mapped);
+    distances->mapping = NULL;
+  }
+  gt_free(chunks);
 
-      if (valid_contig) {
-        /* iterate over space delimited records */
-        while (field != NULL)
-        {
-          /* parse record consisting of contig header, distance,
-             number of pairs, std. dev. */
-          if (sscanf(field,"%[^>,]," GT_WD "," GT_WD ",%f", ctg_header, &dist,
-              &num_pairs, &std_dev) == 4)
-          {
-
-            /* parsing composition,
-             '+' indicates same strand and '-' reverse strand */
-            ctg_header_len = strlen(ctg_header);
-            same = ctg_header[ctg_header_len - 1] == '+' ? true : false;
-
-            /* cut composition sign */
-            ctg_header[ctg_header_len - 1] = '\0';
-
-            gt_str_set(gt_str_field, ctg_header);
-            /* get vertex id corresponding to contig header */
-            valid_contig = gt_scaffolder_graph_get_vertex(graph, &ctg,
-                      gt_str_field);
-
-            if (valid_contig) {
-              /* check if edge between vertices already exists */
-              edge = gt_scaffolder_graph_find_edge(root_ctg, ctg);
-              if (edge != NULL)
-              {
-                if (!ismatepair && edge->std_dev < std_dev)
-                {
-                  gt_scaffolder_graph_alter_edge(edge, dist, std_dev,
-                                               num_pairs,sense, same);
-                }
-              }
-              else {
-                if (same)
-                  twin_dir = !sense;
-                else
-                  twin_dir = sense;
-
-                gt_scaffolder_graph_add_edge(graph, root_ctg, ctg, dist,
-                                             std_dev,num_pairs, sense, same);
-                gt_scaffolder_graph_add_edge(graph, ctg, root_ctg, dist,
-                                             std_dev,num_pairs, twin_dir, same);
-              }
-            }
-          }
-          /* switch direction */
-          else if (*field == ';')
-            sense = sense ? false : true;
+  return had_err;
+}
 
-          field = strtok(NULL," ");
-        }
+/* stage the edges of the resolved records of <*distances> in <builder>, a
+   record of an already staged edge only replaces it if <ismatepair> is false
+   and the record has a larger standard deviation */
+int gt_scaffolder_parser_stage_distances(const GtScaffolderParserDistances
+                                         *distances,
+                                         GtScaffolderGraphBuilder *builder,
+                                         bool ismatepair,
+                                         GtError *err)
+{
+  const GtScaffolderParserDistance *record;
+  GtUword rid, edge, twin;
+  bool twin_dir;
+  int had_err = 0;
+
+  gt_assert(distances != NULL && builder != NULL);
+  gt_assert(distances->mapping == NULL);
+
+  if (distances->nof_records == 0) {
+    had_err = -1;
+    gt_error_set(err, "distance file %s is empty", distances->filename);
+  }
+  else {
+    /* every record yields at most one edge and its twin */
+    gt_scaffolder_graph_builder_reserve_edges(builder,
+                                              2 * distances->nof_records);
+  }
+
+  for (rid = 0; had_err == 0 && rid < distances->nof_records; rid++) {
+    record = distances->records + rid;
+
+    /* check if edge between vertices already exists */
+    edge = gt_scaffolder_graph_builder_find_edge(builder, record->root,
+                                                 record->target);
+    if (edge != GT_UNDEF_UWORD)
+    {
+      if (!ismatepair && builder->edges[edge].std_dev < record->std_dev)
+      {
+        gt_scaffolder_graph_builder_alter_edge(builder, edge, record->dist,
+                                               record->std_dev,
+                                               record->num_pairs,
+                                               record->sense, record->same);
       }
     }
-    fclose(file);
+    else if (builder->nof_edges > GT_SCAFFOLDER_GRAPH_UNDEF_ID - 2) {
+      had_err = -1;
+      gt_error_set(err, "number of distances exceeds the edge ids "
+                        "of the scaffold graph");
+    }
+    else {
+      if (record->same)
+        twin_dir = !record->sense;
+      else
+        twin_dir = record->sense;
+
+      edge = gt_scaffolder_graph_builder_add_edge(builder, record->root,
+             record->target, record->dist, record->std_dev, record->num_pairs,
+             record->sense, record->same);
+      twin = gt_scaffolder_graph_builder_add_edge(builder, record->target,
+             record->root, record->dist, record->std_dev, record->num_pairs,
+             twin_dir, record->same);
+      gt_scaffolder_graph_builder_link_twins(builder, edge, twin);
+    }
   }
 
-  gt_str_delete(gt_str_field);
   return had_err;
 }
 
-/* count contigs with minimum length in callback data
-   (fasta reader callback function, gets called after fasta entry
-   has been read) */
-static int gt_scaffolder_graph_count_ctg(GtUword length,
-                                         void *data,
-                                         GtError* err)
+/* parse distance information of contigs in abyss-dist-format, check its
+   integrity and stage the edges in <builder> */
+int gt_scaffolder_parser_read_distances(const char *filename,
+                                        GtScaffolderGraphBuilder *builder,
+                                        bool ismatepair,
+                                        GtError *err)
 {
+  GtScaffolderParserDistances *distances;
   int had_err;
-  GtScaffolderGraphFastaReaderData *fasta_reader_data =
-  (GtScaffolderGraphFastaReaderData*) data;
 
-  had_err = 0;
-  if (length >= fasta_reader_data->min_ctg_len)
-    fasta_reader_data->nof_valid_ctg++;
-  if (length == 0) {
-    gt_error_set (err , " invalid sequence length ");
-    had_err = -1;
-  }
+  had_err = gt_scaffolder_parser_distances_new(&distances, filename, err);
+  if (had_err == 0)
+    had_err = gt_scaffolder_parser_distances_resolve(distances,
+                                                     builder->graph, err);
+  if (had_err == 0)
+    had_err = gt_scaffolder_parser_stage_distances(distances, builder,
+                                                   ismatepair, err);
+  gt_scaffolder_parser_distances_delete(distances);
+
   return had_err;
 }
 
@@ -422,10 +998,9 @@ static int gt_scaffolder_graph_save_header(const char *description,
                                            void *data, GtError *err)
 {
   int had_err;
-  char *writeable_description, *space_ptr;
+  const char *space_ptr;
   GtScaffolderGraphFastaReaderData *fasta_reader_data =
   (GtScaffolderGraphFastaReaderData*) data;
-  char part_1[BUFSIZE];
   GtWord num_1, num_2;
   float astat, copynum;
 
@@ -437,8 +1012,8 @@ static int gt_scaffolder_graph_save_header(const char *description,
      if so parse it */
   if (fasta_reader_data->astat_is_annotated) {
     if (sscanf(description,
-               "%s length=" GT_WD " depth=" GT_WD " k=%f astat=%f",
-               part_1, &num_1, &num_2, &copynum, &astat) == 5)
+               "%*s length=" GT_WD " depth=" GT_WD " k=%f astat=%f",
+               &num_1, &num_2, &copynum, &astat) == 4)
     {
       fasta_reader_data->astat = astat;
       fasta_reader_data->copynum = copynum;
@@ -449,14 +1024,13 @@ static int gt_scaffolder_graph_save_header(const char *description,
     }
   }
 
-  writeable_description = gt_cstr_dup(description);
-  /* cut header sequence after first space */
-  space_ptr = strchr(writeable_description, ' ');
-  if (space_ptr != NULL)
-    *space_ptr = '\0';
-  /* overwrite current GtString */
-  gt_str_set(fasta_reader_data->header_seq, writeable_description);
-  gt_free(writeable_description);
+  /* cut header sequence after first space and overwrite current GtString,
+     which keeps its buffer from contig to contig */
+  space_ptr = strchr(description, ' ');
+  gt_str_reset(fasta_reader_data->header_seq);
+  gt_str_append_cstr_nt(fasta_reader_data->header_seq, description,
+                        space_ptr != NULL ? (GtUword) (space_ptr - description)
+                                          : strlen(description));
 
   if (length == 0) {
     gt_error_set (err , "Invalid header length");
@@ -473,18 +1047,28 @@ static int gt_scaffolder_graph_save_ctg(GtUword seq_length,
                                         GtError* err)
 {
   int had_err;
-  GtStr *cloned_gt_str;
   GtScaffolderGraphFastaReaderData *fasta_reader_data =
   (GtScaffolderGraphFastaReaderData*) data;
 
   had_err = 0;
+  if (seq_length > fasta_reader_data->min_ctg_len &&
+      fasta_reader_data->builder->graph->nof_vertices ==
+      GT_SCAFFOLDER_GRAPH_UNDEF_ID) {
+    gt_error_set(err, "number of contigs exceeds the vertex ids of the "
+                      "scaffold graph");
+    return -1;
+  }
   if (seq_length > fasta_reader_data->min_ctg_len)
   {
-    cloned_gt_str = gt_str_clone(fasta_reader_data->header_seq);
-    gt_scaffolder_graph_add_vertex(fasta_reader_data->graph,
-    cloned_gt_str, seq_length, fasta_reader_data->astat,
+    /* the header is copied into the name pool of the graph */
+    gt_scaffolder_graph_builder_add_vertex(fasta_reader_data->builder,
+                               gt_str_get(fasta_reader_data->header_seq),
+                               gt_str_length(fasta_reader_data->header_seq),
+                               seq_length, fasta_reader_data->nof_ctg,
+                               fasta_reader_data->astat,
                                fasta_reader_data->copynum);
   }
+  fasta_reader_data->nof_ctg++;
 
   if (seq_length == 0) {
     gt_error_set (err , "Invalid sequence length");
@@ -493,57 +1077,111 @@ static int gt_scaffolder_graph_save_ctg(GtUword seq_length,
   return had_err;
 }
 
-/* count contigs */
+/* count contigs longer than <min_ctg_len> and the total length
+   <*names_length> of their headers up to the first space */
 int gt_scaffolder_parser_count_contigs(const char *filename,
                                        GtUword min_ctg_len,
                                        GtUword *nof_contigs,
+                                       GtUword *names_length,
                                        GtError *err)
 {
-  GtFastaReader* reader;
-  GtStr *str_filename;
-  GtScaffolderGraphFastaReaderData fasta_reader_data;
-  int had_err;
-
-  str_filename = gt_str_new_cstr(filename);
-  fasta_reader_data.nof_valid_ctg = 0;
-  fasta_reader_data.min_ctg_len = min_ctg_len;
-
-  reader = gt_fasta_reader_rec_new(str_filename);
-  had_err = gt_fasta_reader_run(reader, NULL, NULL,
-            gt_scaffolder_graph_count_ctg, &fasta_reader_data, err);
-  gt_fasta_reader_delete(reader);
-  gt_str_delete(str_filename);
+  GtScaffolderCatalog *catalog;
+  GtUword cid;
+
+  *nof_contigs = 0;
+  *names_length = 0;
+
+  /* only the headers and lengths are needed, which the catalog takes from
+     the FASTA index if there is an up to date one */
+  catalog = gt_scaffolder_catalog_new(filename, err);
+  if (catalog == NULL)
+    return -1;
+
+  /* same condition as in gt_scaffolder_parser_read_contigs */
+  for (cid = 0; cid < gt_scaffolder_catalog_nof_contigs(catalog); cid++) {
+    if (gt_scaffolder_catalog_length(catalog, cid) > min_ctg_len) {
+      (*nof_contigs)++;
+      *names_length += gt_scaffolder_catalog_name_length(catalog, cid);
+    }
+  }
+  gt_scaffolder_catalog_delete(catalog);
 
-  *nof_contigs = fasta_reader_data.nof_valid_ctg;
+  return 0;
+}
 
-  return had_err;
+/* add the contigs of <*catalog> longer than <min_ctg_len> as vertices to
+   the scaffold graph of <builder> */
+static int gt_scaffolder_parser_add_catalog(GtScaffolderGraphBuilder
+                                            *builder,
+                                            const GtScaffolderCatalog
+                                            *catalog,
+                                            GtUword min_ctg_len,
+                                            GtError *err)
+{
+  GtUword cid, length;
+
+  for (cid = 0; cid < gt_scaffolder_catalog_nof_contigs(catalog); cid++) {
+    length = gt_scaffolder_catalog_length(catalog, cid);
+    if (length <= min_ctg_len)
+      continue;
+    if (builder->graph->nof_vertices == GT_SCAFFOLDER_GRAPH_UNDEF_ID) {
+      gt_error_set(err, "number of contigs exceeds the vertex ids of the "
+                        "scaffold graph");
+      return -1;
+    }
+    /* the header is copied into the name pool of the graph */
+    gt_scaffolder_graph_builder_add_vertex(builder,
+                               gt_scaffolder_catalog_name(catalog, cid),
+                               gt_scaffolder_catalog_name_length(catalog,
+                                                                 cid),
+                               length, cid, 0.0, 0.0);
+  }
+  return 0;
 }
 
-/* parse contigs in FASTA-format and save them as vertices of
-   scaffold graph */
-int gt_scaffolder_parser_read_contigs(GtScaffolderGraph *graph,
+/* parse contigs in FASTA-format and add them as vertices to the scaffold
+   graph of <builder> */
+int gt_scaffolder_parser_read_contigs(GtScaffolderGraphBuilder *builder,
                                       const char *filename,
                                       GtUword min_ctg_len,
                                       bool astat_is_annotated,
                                       GtError *err)
 {
+  GtScaffolderCatalog *catalog;
   GtFastaReader* reader;
   GtStr *str_filename;
   GtScaffolderGraphFastaReaderData fasta_reader_data;
   int had_err;
 
-  str_filename = gt_str_new_cstr(filename);
-  fasta_reader_data.header_seq = gt_str_new();
-  fasta_reader_data.nof_valid_ctg = 0;
-  fasta_reader_data.min_ctg_len = min_ctg_len;
-  fasta_reader_data.graph = graph;
-  fasta_reader_data.astat_is_annotated = astat_is_annotated;
-
-  reader = gt_fasta_reader_rec_new(str_filename);
-  had_err = gt_fasta_reader_run(reader, gt_scaffolder_graph_save_header,
-            NULL, gt_scaffolder_graph_save_ctg, &fasta_reader_data, err);
-  gt_fasta_reader_delete(reader);
-  gt_str_delete(str_filename);
-  gt_str_delete(fasta_reader_data.header_seq);
+  /* the index keeps no descriptions, annotated A-statistics and copy
+     numbers are only found in the FASTA file itself */
+  if (!astat_is_annotated) {
+    catalog = gt_scaffolder_catalog_new(filename, err);
+    had_err = catalog == NULL ? -1 : 0;
+    if (had_err == 0)
+      had_err = gt_scaffolder_parser_add_catalog(builder, catalog,
+                                                 min_ctg_len, err);
+    gt_scaffolder_catalog_delete(catalog);
+  }
+  else {
+    str_filename = gt_str_new_cstr(filename);
+    fasta_reader_data.header_seq = gt_str_new();
+    fasta_reader_data.nof_ctg = 0;
+    fasta_reader_data.min_ctg_len = min_ctg_len;
+    fasta_reader_data.builder = builder;
+    fasta_reader_data.astat_is_annotated = astat_is_annotated;
+
+    reader = gt_fasta_reader_rec_new(str_filename);
+    had_err = gt_fasta_reader_run(reader, gt_scaffolder_graph_save_header,
+              NULL, gt_scaffolder_graph_save_ctg, &fasta_reader_data, err);
+    gt_fasta_reader_delete(reader);
+    gt_str_delete(str_filename);
+    gt_str_delete(fasta_reader_data.header_seq);
+  }
+
+  /* vertices keep the order of the FASTA file, contig headers are looked up
+     by hashing */
+  if (had_err == 0)
+    gt_scaffolder_graph_index_vertices(builder->graph);
   return had_err;
 }
@@ -20,33 +20,96 @@
 #ifndef GT_SCAFFOLDER_PARSER_H
 #define GT_SCAFFOLDER_PARSER_H
 
+/* distance record of a DistEst file. Until
+   gt_scaffolder_parser_distances_resolve <root> and <target> are the offsets
+   of the contig headers, without composition sign, in the mapped file,
+   afterwards the vertex ids of the contigs. */
+typedef struct {
+  GtUword root;
+  GtUword target;
+  GtWord dist;
+  GtWord num_pairs;
+  float std_dev;
+  unsigned int root_len;
+  unsigned int target_len;
+  bool sense;
+  bool same;
+} GtScaffolderParserDistance;
+
+/* all distance records of a DistEst file, tokenized once from a memory
+   mapping of the file */
+typedef struct GtScaffolderParserDistances {
+  GtScaffolderParserDistance *records;
+  GtUword nof_records;
+  GtUword max_nof_records;
+  /* mapped DistEst file, released by gt_scaffolder_parser_distances_resolve */
+  char *mapping;
+  GtUword mapping_size;
+  /* false if the file could not be mapped and was read into <mapping> */
+  bool mapped;
+  char *filename;
+} GtScaffolderParserDistances;
+
+/* map the DistEst file <filename>, check integrity of abyss-dist-format and
+   store all its records in <*distances_par>. The file is split at line
+   boundaries into chunks, which are tokenized in parallel if <gt_jobs> is
+   larger than one, the records keep the order of the file. */
+int gt_scaffolder_parser_distances_new(GtScaffolderParserDistances
+                                       **distances_par,
+                                       const char *filename,
+                                       GtError *err);
+
+/* delete <*distances> */
+void gt_scaffolder_parser_distances_delete(GtScaffolderParserDistances
+                                           *distances);
+
+/* returns the number of bytes allocated for the records of <*distances>,
+   which are held while the graph is built from them */
+GtUword gt_scaffolder_parser_distances_memory(const
+                                              GtScaffolderParserDistances
+                                              *distances);
+
+/* replace the contig headers of all records of <*distances> by vertex ids of
+   <*graph>, drop the records of contigs not in <*graph> and release the
+   mapped file. The records are resolved in parallel if <gt_jobs> is larger
+   than one and keep their order. */
+int gt_scaffolder_parser_distances_resolve(GtScaffolderParserDistances
+                                           *distances,
+                                           const GtScaffolderGraph *graph,
+                                           GtError *err);
+
+/* stage the edges of the resolved records of <*distances> in <builder>, a
+   record of an already staged edge only replaces it if <ismatepair> is false
+   and the record has a larger standard deviation */
+int gt_scaffolder_parser_stage_distances(const GtScaffolderParserDistances
+                                         *distances,
+                                         GtScaffolderGraphBuilder *builder,
+                                         bool ismatepair,
+                                         GtError *err);
+
 /* test parsing distance records */
 int gt_scaffolder_parser_read_distances_test(const char *filename,
                                              char *output_filename,
                                              GtError *err);
 
-/* count records and check integrity of abyss-dist-format */
-int gt_scaffolder_parser_count_distances(const GtScaffolderGraph *graph,
-                                               const char *file_name,
-                                               GtUword *nof_distances,
-                                               GtError *err);
-
-/* parse distance information of contigs in abyss-dist-format and
-   save them as edges of scaffold graph */
+/* parse distance information of contigs in abyss-dist-format, check its
+   integrity and stage the edges in <builder> */
 int gt_scaffolder_parser_read_distances(const char *filename,
-                                              GtScaffolderGraph *graph,
-                                              bool ismatepair,
-                                              GtError *err);
+                                        GtScaffolderGraphBuilder *builder,
+                                        bool ismatepair,
+                                        GtError *err);
 
-/* count contigs */
+/* count contigs longer than <min_ctg_len> and the total length
+   <*names_length> of their headers up to the first space */
 int gt_scaffolder_parser_count_contigs(const char *filename,
                                        GtUword min_ctg_len,
                                        GtUword *nof_contigs,
+                                       GtUword *names_length,
                                        GtError *err);
 
-/* parse contigs in FASTA-format and save them as vertices of
-   scaffold graph */
-int gt_scaffolder_parser_read_contigs(GtScaffolderGraph *graph,
+/* parse contigs in FASTA-format and add them as vertices to the scaffold
+   graph of <builder> */
+int gt_scaffolder_parser_read_contigs(GtScaffolderGraphBuilder *builder,
                                       const char *filename,
                                       GtUword min_ctg_len,
                                       bool astat_is_annotated,
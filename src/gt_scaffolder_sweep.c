@@ -0,0 +1,115 @@
+/*
+  Copyright (c) 2015 Dorle Osterode, Stefan Dang, Lukas Götz
+  Copyright (c) 2015 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#include "core/array_api.h"
+#include "core/assert_api.h"
+#include "core/ma_api.h"
+#include "core/thread_api.h"
+
+#include "gt_scaffolder_graph.h"
+#include "gt_scaffolder_algorithms.h"
+#include "gt_scaffolder_sweep.h"
+
+/* data shared by all threads of a sweep */
+typedef struct {
+  const GtScaffolderGraph *graph;
+  GtScaffolderGraphStates *initial_states;
+  const GtScaffolderSweepCutoffs *cutoffs;
+  GtUword nof_cutoffs,
+          next_job;
+  GtAssemblyStatsCalculator **scaf_stats;
+  GtMutex *mutex;
+} GtScaffolderSweepInfo;
+
+/* run all jobs of the sweep on a private view of the graph until no job is
+   left */
+static void *gt_scaffolder_sweep_thread(void *data)
+{
+  GtScaffolderSweepInfo *info = data;
+  const GtScaffolderSweepCutoffs *cutoffs;
+  GtScaffolderGraph *view, *compacted;
+  GtScaffolderGraphRecord *rec;
+  GtArray *recs;
+  GtUword job, i;
+
+  view = gt_scaffolder_graph_new_view(info->graph);
+
+  while (true) {
+    /* fetch index of next combination of cutoffs */
+    gt_mutex_lock(info->mutex);
+    job = info->next_job;
+    if (job < info->nof_cutoffs)
+      info->next_job++;
+    gt_mutex_unlock(info->mutex);
+    if (job >= info->nof_cutoffs)
+      break;
+
+    cutoffs = info->cutoffs + job;
+    gt_scaffolder_graph_states_restore(view, info->initial_states);
+    gt_scaffolder_graph_mark_repeat_vertices(view, cutoffs->copy_num_cutoff,
+                                             cutoffs->astat_cutoff);
+    gt_scaffolder_graph_filter(view, cutoffs->probability_cutoff,
+                               cutoffs->copy_num_cutoff_2,
+                               cutoffs->overlap_cutoff);
+
+    /* scaffold without the filtered edges */
+    compacted = gt_scaffolder_graph_new_compacted(view);
+    gt_scaffolder_makescaffold(compacted);
+
+    recs = gt_scaffolder_graph_iterate_scaffolds(compacted,
+                                                 info->scaf_stats[job]);
+    for (i = 0; i < gt_array_size(recs); i++) {
+      rec = *(GtScaffolderGraphRecord **) gt_array_get(recs, i);
+      gt_scaffolder_graph_record_delete(rec);
+    }
+    gt_array_delete(recs);
+    gt_scaffolder_graph_delete(compacted);
+  }
+
+  gt_scaffolder_graph_delete(view);
+  return NULL;
+}
+
+/* scaffold <*graph> once for every combination of cutoffs in parallel */
+int gt_scaffolder_sweep(const GtScaffolderGraph *graph,
+                        const GtScaffolderSweepCutoffs *cutoffs,
+                        GtUword nof_cutoffs,
+                        GtAssemblyStatsCalculator **scaf_stats,
+                        GtError *err)
+{
+  GtScaffolderSweepInfo info;
+  int had_err;
+
+  gt_error_check(err);
+  gt_assert(graph != NULL);
+  gt_assert(cutoffs != NULL && scaf_stats != NULL);
+
+  info.graph = graph;
+  info.initial_states = gt_scaffolder_graph_states_new(graph);
+  info.cutoffs = cutoffs;
+  info.nof_cutoffs = nof_cutoffs;
+  info.next_job = 0;
+  info.scaf_stats = scaf_stats;
+  info.mutex = gt_mutex_new();
+
+  had_err = gt_multithread(gt_scaffolder_sweep_thread, &info, err);
+
+  gt_mutex_delete(info.mutex);
+  gt_scaffolder_graph_states_delete(info.initial_states);
+
+  return had_err;
+}
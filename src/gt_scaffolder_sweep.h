@@ -0,0 +1,47 @@
+/*
+  Copyright (c) 2015 Dorle Osterode, Stefan Dang, Lukas Götz
+  Copyright (c) 2015 Center for Bioinformatics, University of Hamburg
+
+  Permission to use, copy, modify, and distribute this software for any
+  purpose with or without fee is hereby granted, provided that the above
+  copyright notice and this permission notice appear in all copies.
+
+  THE SOFTWARE IS PROVIDED "AS IS" AND THE AUTHOR DISCLAIMS ALL WARRANTIES
+  WITH REGARD TO THIS SOFTWARE INCLUDING ALL IMPLIED WARRANTIES OF
+  MERCHANTABILITY AND FITNESS. IN NO EVENT SHALL THE AUTHOR BE LIABLE FOR
+  ANY SPECIAL, DIRECT, INDIRECT, OR CONSEQUENTIAL DAMAGES OR ANY DAMAGES
+  WHATSOEVER RESULTING FROM LOSS OF USE, DATA OR PROFITS, WHETHER IN AN
+  ACTION OF CONTRACT, NEGLIGENCE OR OTHER TORTIOUS ACTION, ARISING OUT OF
+  OR IN CONNECTION WITH THE USE OR PERFORMANCE OF THIS SOFTWARE.
+*/
+
+#ifndef GT_SCAFFOLDER_SWEEP_H
+#define GT_SCAFFOLDER_SWEEP_H
+
+#include "core/error_api.h"
+#include "core/types_api.h"
+#include "extended/assembly_stats_calculator.h"
+
+#include "gt_scaffolder_graph.h"
+
+/* one combination of cutoffs for repeat marking, filtering and scaffolding */
+typedef struct GtScaffolderSweepCutoffs {
+  float copy_num_cutoff,
+        astat_cutoff,
+        probability_cutoff,
+        copy_num_cutoff_2;
+  GtWord overlap_cutoff;
+} GtScaffolderSweepCutoffs;
+
+/* scaffold <*graph> once for every of the <nof_cutoffs> combinations in
+   <*cutoffs> and add the scaffold lengths of combination i to
+   <scaf_stats[i]>. The jobs are distributed over <gt_jobs> threads, each
+   working on its own view of <*graph>. The a-statistics and copy numbers
+   must already be loaded into <*graph>, whose states are left untouched */
+int gt_scaffolder_sweep(const GtScaffolderGraph *graph,
+                        const GtScaffolderSweepCutoffs *cutoffs,
+                        GtUword nof_cutoffs,
+                        GtAssemblyStatsCalculator **scaf_stats,
+                        GtError *err);
+
+#endif
@@ -19,17 +19,23 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
 
+#include "core/array_api.h"
 #include "core/init_api.h"
 #include "core/logger.h"
+#include "core/ma_api.h"
+#include "core/thread_api.h"
 #include "core/types_api.h"
 #include "extended/assembly_stats_calculator.h"
 
 #include "gt_scaffolder_graph.h"
 #include "gt_scaffolder_algorithms.h"
+#include "gt_scaffolder_catalog.h"
 #include "gt_scaffolder_parser.h"
 #include "gt_scaffolder_bamparser.h"
 #include "gt_scaffolder_generate_fasta.h"
+#include "gt_scaffolder_sweep.h"
 
 /* adapted from SGA examples */
 #define MIN_CONTIG_LEN 200
@@ -53,18 +59,81 @@
 /* if astat is annotated in contig header */
 #define ASTAT_IS_ANNOTATED false
 
+/* print memory <*memory> of the scaffold graph arrays with <logger>,
+   prefixed by <kind> */
+static void print_graph_memory(GtLogger *logger, const char *kind,
+                               const GtScaffolderGraphMemory *memory)
+{
+  gt_logger_log(logger, "%s graph memory: vertices " GT_WU " adjacency " GT_WU
+                " edges " GT_WU " names " GT_WU " total " GT_WU " bytes", kind,
+                memory->vertices, memory->adjacency, memory->edges,
+                memory->names, memory->total);
+}
+
+/* log the number of vertices and edges of <*graph> in the states set by the
+   algorithms after stage <stage> */
+static void print_graph_census(GtLogger *logger, const char *stage,
+                               const GtScaffolderGraph *graph)
+{
+  gt_logger_log(logger, "census after %s: vertices repeat " GT_WU
+                " polymorphic " GT_WU " cyclic " GT_WU " scaffold " GT_WU,
+                stage,
+                gt_scaffolder_graph_nof_vertices_in_state(graph, GIS_REPEAT),
+                gt_scaffolder_graph_nof_vertices_in_state(graph,
+                                                          GIS_POLYMORPHIC),
+                gt_scaffolder_graph_nof_vertices_in_state(graph, GIS_CYCLIC),
+                gt_scaffolder_graph_nof_vertices_in_state(graph,
+                                                          GIS_SCAFFOLD));
+  gt_logger_log(logger, "census after %s: edges repeat " GT_WU
+                " polymorphic " GT_WU " inconsistent " GT_WU " cyclic " GT_WU
+                " scaffold " GT_WU, stage,
+                gt_scaffolder_graph_nof_edges_in_state(graph, GIS_REPEAT),
+                gt_scaffolder_graph_nof_edges_in_state(graph, GIS_POLYMORPHIC),
+                gt_scaffolder_graph_nof_edges_in_state(graph,
+                                                       GIS_INCONSISTENT),
+                gt_scaffolder_graph_nof_edges_in_state(graph, GIS_CYCLIC),
+                gt_scaffolder_graph_nof_edges_in_state(graph, GIS_SCAFFOLD));
+}
+
+/* parse comma separated list of cutoffs <list> into <*values>, returns false
+   if the list contains something else than numbers */
+static bool parse_cutoff_list(const char *list, GtArray *values)
+{
+  const char *pos = list;
+  char *end;
+  double value;
+
+  while (true) {
+    value = strtod(pos, &end);
+    if (end == pos)
+      return false;
+    gt_array_add(values, value);
+    if (*end == '\0')
+      return true;
+    if (*end != ',')
+      return false;
+    pos = end + 1;
+  }
+}
+
 int main(int argc, char **argv)
 {
   GtError *err;
-  GtScaffolderGraph *graph;
+  GtScaffolderGraph *graph, *compacted;
+  GtScaffolderGraphStates *filtered_states;
+  GtScaffolderGraphMemory memory;
+  GtLogger *logger;
   char *contig_filename, *dist_filename, *astat_filename,
     *bam_filename, *spm_filename;
   int had_err = 0;
+  bool renumber, components;
   DistRecords *dist;
 
   if (argc == 1 || sscanf(argv[1], "%s", argv[1]) != 1) {
     fprintf(stderr, "Usage: %s <module> <arguments>\n\n"
-            "MODULES:\n graph\n parser\n scaffold\n bamparser\n", argv[0]);
+            "MODULES:\n graph\n parser\n scaffold\n sweep\n bamparser\n"
+            " faidx\n",
+            argv[0]);
     exit(EXIT_FAILURE);
   }
 
@@ -112,23 +181,110 @@ int main(int argc, char **argv)
       dist_filename = argv[2];
       had_err = gt_scaffolder_parser_read_distances_test(dist_filename,
                 "gt_scaffolder_parser_test_read_distances.de", err);
+      if (had_err != 0)
+        fprintf(stderr, "ERROR: %s\n", gt_error_get(err));
     }
   }
 
   else if (strcmp(argv[1], "scaffold") == 0) {
-    if (argc != 6) {
-      fprintf(stderr, "Usage: <FASTA-file with contigs> <DistEst file> "
-                      "<astat file> <spm file>\n");
+    unsigned int nof_jobs = 1;
+
+    /* optionally renumber vertices for locality of the graph traversals,
+       scaffold every connected component separately and parse the DistEst
+       file with several threads */
+    renumber = false;
+    components = false;
+    while (argc > 2 && (strcmp(argv[2], "-renumber") == 0 ||
+                        strcmp(argv[2], "-components") == 0 ||
+                        strcmp(argv[2], "-jobs") == 0)) {
+      if (strcmp(argv[2], "-renumber") == 0)
+        renumber = true;
+      else if (strcmp(argv[2], "-components") == 0)
+        components = true;
+      else {
+        if (argc < 4 || sscanf(argv[3], "%u", &nof_jobs) != 1 ||
+            nof_jobs == 0)
+          break;
+        argv++;
+        argc--;
+      }
+      argv++;
+      argc--;
+    }
+    gt_jobs = nof_jobs;
+    if (argc != 6 && argc != 7) {
+      fprintf(stderr, "Usage: [-renumber] [-components] [-jobs <n>] "
+                      "<FASTA-file with contigs> "
+                      "<DistEst file> <astat file> <spm file> "
+                      "[<graph snapshot file>]\n");
       return EXIT_FAILURE;
     } else {
+      GtScaffolderGraphSnapshotSource source, snapshot_source;
+
       graph = NULL;
+      compacted = NULL;
       contig_filename = argv[2];
       dist_filename = argv[3];
       astat_filename = argv[4];
       spm_filename = argv[5];
 
-      had_err = gt_scaffolder_graph_new_from_file(&graph, contig_filename,
-                MIN_CONTIG_LEN, dist_filename, ASTAT_IS_ANNOTATED, err);
+      logger = gt_logger_new(true, "[scaffolder] ", stderr);
+
+      /* reuse an existing snapshot instead of parsing the input again, if it
+         was built from the same input */
+      if (argc == 7)
+        had_err = gt_scaffolder_graph_snapshot_source_init(&source,
+                  contig_filename, dist_filename, renumber, err);
+      if (had_err == 0 && argc == 7 && access(argv[6], F_OK) == 0) {
+        had_err = gt_scaffolder_graph_load(&graph, argv[6], &snapshot_source,
+                                           err);
+        if (had_err == 0 &&
+            !gt_scaffolder_graph_snapshot_source_equal(&source,
+                                                       &snapshot_source)) {
+          gt_error_set(err, "snapshot file %s was built from other input "
+                            "files or options", argv[6]);
+          had_err = -1;
+          gt_scaffolder_graph_delete(graph);
+          graph = NULL;
+        }
+      }
+      else if (had_err == 0) {
+        GtScaffolderParserDistances *distances = NULL;
+        GtUword nof_contigs, names_length, peak;
+
+        /* predict the memory needed before the graph is allocated, the
+           distance records are tokenized once for the estimate and the
+           graph */
+        had_err = gt_scaffolder_parser_count_contigs(contig_filename,
+                  MIN_CONTIG_LEN, &nof_contigs, &names_length, err);
+        if (had_err == 0)
+          had_err = gt_scaffolder_parser_distances_new(&distances,
+                    dist_filename, err);
+        if (had_err == 0) {
+          /* every record yields at most one edge and its twin */
+          peak = gt_scaffolder_graph_estimate_memory(nof_contigs,
+                 2 * distances->nof_records, names_length,
+                 gt_scaffolder_parser_distances_memory(distances), &memory);
+          print_graph_memory(logger, "estimated", &memory);
+          gt_logger_log(logger, "estimated peak memory: " GT_WU " bytes",
+                        peak);
+        }
+
+        if (had_err == 0)
+          had_err = gt_scaffolder_graph_new_from_distances(&graph,
+                    contig_filename, MIN_CONTIG_LEN, distances,
+                    ASTAT_IS_ANNOTATED, err);
+        gt_scaffolder_parser_distances_delete(distances);
+        if (renumber && had_err == 0)
+          gt_scaffolder_graph_renumber_vertices(graph);
+        if (argc == 7 && had_err == 0)
+          had_err = gt_scaffolder_graph_save(graph, argv[6], &source, err);
+      }
+
+      if (had_err == 0) {
+        gt_scaffolder_graph_memory(graph, &memory);
+        print_graph_memory(logger, "actual", &memory);
+      }
 
       if (!ASTAT_IS_ANNOTATED && had_err == 0) {
         /* load astatistics and copy number from file */
@@ -140,40 +296,57 @@ int main(int argc, char **argv)
 
         gt_scaffolder_graph_print(graph,
               "gt_scaffolder_algorithms_test_mark_repeats.dot", err);
+        print_graph_census(logger, "mark_repeats", graph);
 
         /* mark polymorphic vertices, edges and inconsistent edges */
         gt_scaffolder_graph_filter(graph, PROBABILITY_CUTOFF,
                   COPY_NUM_CUTOFF_2, OVERLAP_CUTOFF);
         gt_scaffolder_graph_print(graph,
               "gt_scaffolder_algorithms_test_filter.dot", err);
+        print_graph_census(logger, "filter", graph);
 
-        /* SD: makescaffold includes _removecycles(), perform on copy? */
+        /* makescaffold includes _removecycles(), so the states of the
+           filtered graph are restored afterwards */
+        filtered_states = gt_scaffolder_graph_states_new(graph);
         gt_scaffolder_removecycles(graph);
         gt_scaffolder_graph_print(graph,
               "gt_scaffolder_algorithms_test_removecycles.dot", err);
-
-        gt_scaffolder_makescaffold(graph);
+        print_graph_census(logger, "removecycles", graph);
+        gt_scaffolder_graph_states_restore(graph, filtered_states);
+        gt_scaffolder_graph_states_delete(filtered_states);
+
+        /* scaffold without the filtered edges, which stay in the graph for
+           the DOT output */
+        compacted = gt_scaffolder_graph_new_compacted(graph);
+        if (components)
+          gt_scaffolder_makescaffold_components(compacted);
+        else
+          gt_scaffolder_makescaffold(compacted);
+        print_graph_census(logger, "makescaffold (compacted)", compacted);
+        gt_scaffolder_graph_merge_compacted(graph, compacted);
         gt_scaffolder_graph_print(graph,
               "gt_scaffolder_algorithms_test_makescaffold.dot", err);
+        print_graph_census(logger, "makescaffold", graph);
       }
 
       if (had_err == 0) {
         GtUword i;
         GtScaffolderGraphRecord *rec;
-        GtLogger *logger;
         GtArray *recs;
         GtAssemblyStatsCalculator *scaf_stats =
                                       gt_assembly_stats_calculator_new();
 
-        recs = gt_scaffolder_graph_iterate_scaffolds(graph, scaf_stats);
+        /* the records refer to the edges of the compacted view */
+        recs = gt_scaffolder_graph_iterate_scaffolds(compacted, scaf_stats);
 
-        gt_scaffolder_graph_write_scaffold(recs, "gt_scaffolder_new_write.scaf",
-          err);
+        gt_scaffolder_graph_write_scaffold(compacted, recs,
+          "gt_scaffolder_new_write.scaf", err);
 
         /* test the new generate_fasta function */
         if (strcmp(spm_filename, "false") != 0)
-          had_err = gt_scaffolder_graph_generate_fasta(contig_filename,
-                      spm_filename, "generate_fasta.fa", recs, err);
+          had_err = gt_scaffolder_graph_generate_fasta(compacted,
+                      contig_filename, spm_filename, "generate_fasta.fa",
+                      recs, err);
 
         if (had_err != 0)
           fprintf(stderr, "%s\n", gt_error_get(err));
@@ -184,17 +357,107 @@ int main(int argc, char **argv)
         }
         gt_array_delete(recs);
 
-        logger = gt_logger_new(true, "[scaffolder] ", stderr);
         gt_assembly_stats_calculator_nstat(scaf_stats, 50);
         gt_assembly_stats_calculator_show(scaf_stats, logger);
 
-        gt_logger_delete(logger);
         gt_assembly_stats_calculator_delete(scaf_stats);
       }
 
       if (had_err != 0)
         fprintf(stderr,"ERROR: %s\n",gt_error_get(err));
 
+      gt_logger_delete(logger);
+      gt_scaffolder_graph_delete(compacted);
+      gt_scaffolder_graph_delete(graph);
+    }
+  }
+  else if (strcmp(argv[1], "sweep") == 0) {
+    /* scaffold once for every combination of the cutoff lists */
+    GtArray *lists[5];
+    GtScaffolderSweepCutoffs *cutoffs;
+    GtAssemblyStatsCalculator **scaf_stats;
+    GtLogger *logger;
+    GtUword nof_cutoffs, i, j, k;
+    unsigned int nof_threads;
+    char prefix[BUFSIZ];
+    bool valid_lists = true;
+
+    for (j = 0; j < 5; j++)
+      lists[j] = gt_array_new(sizeof (double));
+    if (argc == 11)
+      for (j = 0; j < 5; j++)
+        valid_lists = valid_lists && parse_cutoff_list(argv[6 + j], lists[j]);
+    if (argc != 11 || !valid_lists ||
+        sscanf(argv[5], "%u", &nof_threads) != 1 || nof_threads == 0) {
+      fprintf(stderr, "Usage: <FASTA-file with contigs> <DistEst file> "
+                      "<astat file> <nof threads> <copy num cutoffs> "
+                      "<astat cutoffs> <probability cutoffs> "
+                      "<copy num cutoffs 2> <overlap cutoffs>\n"
+                      "each cutoff argument is a comma separated list\n");
+      for (j = 0; j < 5; j++)
+        gt_array_delete(lists[j]);
+      return EXIT_FAILURE;
+    } else {
+      graph = NULL;
+      contig_filename = argv[2];
+      dist_filename = argv[3];
+      astat_filename = argv[4];
+
+      /* build the cartesian product of all cutoff lists */
+      nof_cutoffs = 1;
+      for (j = 0; j < 5; j++)
+        nof_cutoffs *= gt_array_size(lists[j]);
+      cutoffs = gt_malloc(sizeof (*cutoffs) * nof_cutoffs);
+      scaf_stats = gt_malloc(sizeof (*scaf_stats) * nof_cutoffs);
+      for (i = 0; i < nof_cutoffs; i++) {
+        double values[5];
+        k = i;
+        for (j = 5; j > 0; j--) {
+          values[j - 1] = *(double *) gt_array_get(lists[j - 1],
+                          k % gt_array_size(lists[j - 1]));
+          k /= gt_array_size(lists[j - 1]);
+        }
+        cutoffs[i].copy_num_cutoff = values[0];
+        cutoffs[i].astat_cutoff = values[1];
+        cutoffs[i].probability_cutoff = values[2];
+        cutoffs[i].copy_num_cutoff_2 = values[3];
+        cutoffs[i].overlap_cutoff = values[4];
+        scaf_stats[i] = gt_assembly_stats_calculator_new();
+      }
+
+      /* parse the input and load the astatistics only once */
+      had_err = gt_scaffolder_graph_new_from_file(&graph, contig_filename,
+                MIN_CONTIG_LEN, dist_filename, ASTAT_IS_ANNOTATED, err);
+      if (!ASTAT_IS_ANNOTATED && had_err == 0)
+        had_err = gt_scaffolder_graph_load_astat(astat_filename, graph, err);
+
+      if (had_err == 0) {
+        gt_jobs = nof_threads;
+        had_err = gt_scaffolder_sweep(graph, cutoffs, nof_cutoffs,
+                                      scaf_stats, err);
+      }
+
+      for (i = 0; i < nof_cutoffs; i++) {
+        if (had_err == 0) {
+          snprintf(prefix, sizeof (prefix), "[sweep %.2f %.2f %.2f %.2f "
+                   GT_WD "] ", cutoffs[i].copy_num_cutoff,
+                   cutoffs[i].astat_cutoff, cutoffs[i].probability_cutoff,
+                   cutoffs[i].copy_num_cutoff_2, cutoffs[i].overlap_cutoff);
+          logger = gt_logger_new(true, prefix, stderr);
+          gt_assembly_stats_calculator_nstat(scaf_stats[i], 50);
+          gt_assembly_stats_calculator_show(scaf_stats[i], logger);
+          gt_logger_delete(logger);
+        }
+        gt_assembly_stats_calculator_delete(scaf_stats[i]);
+      }
+
+      if (had_err != 0)
+        fprintf(stderr,"ERROR: %s\n",gt_error_get(err));
+
+      gt_free(scaf_stats);
+      gt_free(cutoffs);
+      for (j = 0; j < 5; j++)
+        gt_array_delete(lists[j]);
       gt_scaffolder_graph_delete(graph);
     }
   }
@@ -221,9 +484,53 @@ int main(int argc, char **argv)
       gt_scaffolder_bamparser_delete_dist_records(dist);
     }
   }
+  else if (strcmp(argv[1], "faidx") == 0) {
+    if (argc != 3 && argc != 4) {
+      fprintf(stderr, "Usage:<Contigs> [<contig header>]\n");
+      return EXIT_FAILURE;
+    } else {
+      GtScaffolderCatalog *catalog;
+      GtStr *seq;
+      GtUword cid;
+
+      /* write the index <Contigs>.fai, which later runs read instead of
+         the contig file, or print the sequence of the given contig */
+      contig_filename = argv[2];
+      catalog = gt_scaffolder_catalog_new(contig_filename, err);
+      had_err = catalog == NULL ? -1 : 0;
+      if (had_err == 0 && argc == 3)
+        had_err = gt_scaffolder_catalog_write_index(catalog, err);
+      else if (had_err == 0) {
+        for (cid = 0; cid < gt_scaffolder_catalog_nof_contigs(catalog); cid++)
+        {
+          if (strcmp(gt_scaffolder_catalog_name(catalog, cid), argv[3]) == 0)
+            break;
+        }
+        if (cid == gt_scaffolder_catalog_nof_contigs(catalog)) {
+          gt_error_set(err, "contig %s not found in %s", argv[3],
+                       contig_filename);
+          had_err = -1;
+        }
+        else {
+          seq = gt_str_new();
+          had_err = gt_scaffolder_catalog_get_sequence(catalog, cid, seq,
+                                                       err);
+          if (had_err == 0)
+            printf("%s\n", gt_str_get(seq));
+          gt_str_delete(seq);
+        }
+      }
+      gt_scaffolder_catalog_delete(catalog);
+
+      if (had_err != 0)
+        fprintf(stderr, "ERROR: %s\n", gt_error_get(err));
+    }
+  }
   else {
     fprintf(stderr, "Usage: %s <module> <arguments>\n\n"
-            "MODULES:\n graph\n parser\n scaffold\n bamparser\n", argv[0]);
+            "MODULES:\n graph\n parser\n scaffold\n sweep\n bamparser\n"
+            " faidx\n",
+            argv[0]);
     exit(EXIT_FAILURE);
   }
 
@@ -112,3 +112,166 @@ Test do
   run("#{$testsuite}diff_graph_files.rb #{$testdata}/sga_makeScaffolds.dot \
   gt_scaffolder_algorithms_test_makescaffold.dot", :retval => 0)
 end
+
+Name "gt scaffolder scaffold: read distances from stdin"
+Keywords "scaffold DistEst"
+Test do
+  run("cat #{$testdata}/libPE.de | #{$bin}test.x scaffold #{$testdata}/primary-contigs.fa /dev/stdin #{$testdata}/libPE.astat false", :retval => 0)
+  run("diff $(pwd)/gt_scaffolder_algorithms_test_makescaffold.dot #{$testdata}gt_scaffolder_algorithms_test_makescaffold_expected.dot", :retval => 0)
+end
+
+Name "gt scaffolder scaffold: parse distances in parallel chunks"
+Keywords "scaffold DistEst jobs"
+Test do
+  # large enough to be split into several chunks for tokenizing and resolving
+  run("yes #{$testdata}/libPE.de | head -n 12000 | xargs cat > large.de")
+  run("#{$bin}test.x scaffold -jobs 1 #{$testdata}/primary-contigs.fa large.de #{$testdata}/libPE.astat false", :retval => 0)
+  run("mv gt_scaffolder_algorithms_test_makescaffold.dot jobs1.dot")
+  run("mv gt_scaffolder_new_write.scaf jobs1.scaf")
+  run("#{$bin}test.x scaffold -jobs 4 #{$testdata}/primary-contigs.fa large.de #{$testdata}/libPE.astat false", :retval => 0)
+  run("diff jobs1.dot gt_scaffolder_algorithms_test_makescaffold.dot", :retval => 0)
+  run("diff jobs1.scaf gt_scaffolder_new_write.scaf", :retval => 0)
+  run("diff jobs1.dot #{$testdata}gt_scaffolder_algorithms_test_makescaffold_expected.dot", :retval => 0)
+  # the error of the first invalid line in file order is reported
+  run("(yes #{$testdata}/libPE.de | head -n 7000 | xargs cat; " \
+      "echo 'contig-1 contig-2+,10,-3,1.0 ;'; " \
+      "yes #{$testdata}/libPE.de | head -n 3000 | xargs cat; " \
+      "echo 'contig-1'; " \
+      "yes #{$testdata}/libPE.de | head -n 2000 | xargs cat) > invalid.de")
+  run("#{$bin}test.x scaffold -jobs 1 #{$testdata}/primary-contigs.fa invalid.de #{$testdata}/libPE.astat false", :retval => 255)
+  grep(last_stderr, /Invalid value for number of pairs in dist file invalid.de/)
+  run("#{$bin}test.x scaffold -jobs 4 #{$testdata}/primary-contigs.fa invalid.de #{$testdata}/libPE.astat false", :retval => 255)
+  grep(last_stderr, /Invalid value for number of pairs in dist file invalid.de/)
+end
+
+Name "gt scaffolder scaffold: reload graph snapshot"
+Keywords "scaffold snapshot"
+Test do
+  run("#{$bin}test.x scaffold #{$testdata}/primary-contigs.fa #{$testdata}/libPE.de #{$testdata}/libPE.astat false graph.snapshot", :retval => 0)
+  run("diff $(pwd)/gt_scaffolder_algorithms_test_makescaffold.dot #{$testdata}gt_scaffolder_algorithms_test_makescaffold_expected.dot", :retval => 0)
+  run("#{$bin}test.x scaffold #{$testdata}/primary-contigs.fa #{$testdata}/libPE.de #{$testdata}/libPE.astat false graph.snapshot", :retval => 0)
+  run("diff $(pwd)/gt_scaffolder_algorithms_test_makescaffold.dot #{$testdata}gt_scaffolder_algorithms_test_makescaffold_expected.dot", :retval => 0)
+end
+
+Name "gt scaffolder scaffold: reject snapshot of other input"
+Keywords "scaffold snapshot"
+Test do
+  run("cp #{$testdata}/primary-contigs.fa #{$testdata}/libPE.de .")
+  run("#{$bin}test.x scaffold primary-contigs.fa libPE.de #{$testdata}/libPE.astat false graph.snapshot", :retval => 0)
+  run("#{$bin}test.x scaffold -renumber primary-contigs.fa libPE.de #{$testdata}/libPE.astat false graph.snapshot", :retval => 255)
+  grep(last_stderr, /snapshot file graph.snapshot was built from other input files or options/)
+  run("touch -d '2000-01-01' libPE.de")
+  run("#{$bin}test.x scaffold primary-contigs.fa libPE.de #{$testdata}/libPE.astat false graph.snapshot", :retval => 255)
+  grep(last_stderr, /snapshot file graph.snapshot was built from other input files or options/)
+end
+
+Name "gt scaffolder scaffold: renumber vertices"
+Keywords "scaffold renumber"
+Test do
+  run("#{$bin}test.x scaffold -renumber #{$testdata}/primary-contigs.fa #{$testdata}/libPE.de #{$testdata}/libPE.astat false", :retval => 0)
+  run("#{$testsuite}diff_graph_files.rb #{$testdata}/sga_makeScaffolds.dot \
+  gt_scaffolder_algorithms_test_makescaffold.dot", :retval => 0)
+end
+
+Name "gt scaffolder sweep: scaffold parameter grid"
+Keywords "scaffold sweep"
+Test do
+  run("#{$bin}test.x sweep #{$testdata}/primary-contigs.fa #{$testdata}/libPE.de #{$testdata}/libPE.astat 2 0.3 20.0,60.0 0.01 1.5 400", :retval => 0)
+  grep(last_stderr, /\[sweep 0\.30 20\.00 0\.01 1\.50 400\] number of contigs:\s+38/)
+  grep(last_stderr, /\[sweep 0\.30 60\.00 0\.01 1\.50 400\] number of contigs:\s+32/)
+end
+
+Name "gt scaffolder scaffold: scaffold components separately"
+Keywords "scaffold components"
+Test do
+  run("#{$bin}test.x scaffold -components #{$testdata}/primary-contigs.fa #{$testdata}/libPE.de #{$testdata}/libPE.astat false", :retval => 0)
+  grep(last_stderr, /N50\s+11238/)
+  run("diff $(pwd)/gt_scaffolder_algorithms_test_makescaffold.dot #{$testdata}gt_scaffolder_algorithms_test_makescaffold_expected.dot", :retval => 0)
+end
+
+Name "gt scaffolder scaffold: report graph memory"
+Keywords "scaffold memory"
+Test do
+  run("#{$bin}test.x scaffold #{$testdata}/primary-contigs.fa #{$testdata}/libPE.de #{$testdata}/libPE.astat false", :retval => 0)
+  grep(last_stderr, /estimated graph memory: vertices \d+ adjacency \d+ edges \d+ names \d+ total \d+ bytes/)
+  grep(last_stderr, /estimated peak memory: \d+ bytes/)
+  grep(last_stderr, /actual graph memory: vertices \d+ adjacency \d+ edges \d+ names \d+ total \d+ bytes/)
+end
+
+Name "gt scaffolder scaffold: report state census"
+Keywords "scaffold census"
+Test do
+  run("#{$bin}test.x scaffold #{$testdata}/primary-contigs.fa #{$testdata}/libPE.de #{$testdata}/libPE.astat false", :retval => 0)
+  grep(last_stderr, /census after mark_repeats: vertices repeat 8 polymorphic 0 cyclic 0 scaffold 0/)
+  grep(last_stderr, /census after makescaffold \(compacted\): vertices repeat 8 polymorphic 0 cyclic 0 scaffold 42/)
+  grep(last_stderr, /census after makescaffold: vertices repeat 8 polymorphic 0 cyclic 0 scaffold 42/)
+  grep(last_stderr, /census after makescaffold: edges repeat 0 polymorphic 0 inconsistent 0 cyclic 0 scaffold 8/)
+end
+
+Name "gt scaffolder scaffold: reuse FASTA index"
+Keywords "scaffold faidx"
+Test do
+  run("cp #{$testdata}/primary-contigs.fa .")
+  run("#{$bin}test.x faidx primary-contigs.fa", :retval => 0)
+  run("test -s primary-contigs.fa.fai", :retval => 0)
+  run("#{$bin}test.x scaffold primary-contigs.fa #{$testdata}/libPE.de #{$testdata}/libPE.astat false", :retval => 0)
+  run("diff $(pwd)/gt_scaffolder_algorithms_test_makescaffold.dot #{$testdata}gt_scaffolder_algorithms_test_makescaffold_expected.dot", :retval => 0)
+end
+
+Name "gt scaffolder faidx: fetch contig by index"
+Keywords "faidx"
+Test do
+  run("cp #{$testdata}/primary-contigs.fa .")
+  run("#{$bin}test.x faidx primary-contigs.fa", :retval => 0)
+  run("#{$bin}test.x faidx primary-contigs.fa contig-3826", :retval => 0)
+  run("grep -A1 '^>contig-3826 ' primary-contigs.fa | tail -n 1 | diff - #{last_stdout}", :retval => 0)
+  run("printf '>a\\nACGT\\nAC\\n>b\\nACGT\\nACGT' > wrapped.fa")
+  run("#{$bin}test.x faidx wrapped.fa", :retval => 0)
+  run("#{$bin}test.x faidx wrapped.fa b", :retval => 0)
+  run("echo ACGTACGT | diff - #{last_stdout}", :retval => 0)
+end
+
+Name "gt scaffolder faidx: ignore stale index"
+Keywords "faidx"
+Test do
+  run("printf '>a\\nACGT\\nAC\\n>b\\nACGT\\nACGT\\n' > stale.fa")
+  run("#{$bin}test.x faidx stale.fa", :retval => 0)
+  # rewritten in the same second as the index
+  run("printf '>a\\nAC\\n>b\\nTTTTTTTT\\n' > stale.fa")
+  run("#{$bin}test.x faidx stale.fa b", :retval => 0)
+  run("echo TTTTTTTT | diff - #{last_stdout}", :retval => 0)
+  # copied in with an old modification time
+  run("#{$bin}test.x faidx stale.fa", :retval => 0)
+  run("printf '>a\\nGGGGGG\\n>b\\nCCCCCCCCC\\n' > stale.fa")
+  run("touch -d '2000-01-01' stale.fa")
+  run("#{$bin}test.x faidx stale.fa b", :retval => 0)
+  run("echo CCCCCCCCC | diff - #{last_stdout}", :retval => 0)
+end
+
+Name "gt scaffolder scaffold: long DistEst lines"
+Keywords "scaffold DistEst"
+Test do
+  run("#{$bin}test.x scaffold #{$testdata}/primary-contigs.fa #{$testdata}/libPE_longlines.de #{$testdata}/libPE.astat false", :retval => 0)
+  run("mv gt_scaffolder_algorithms_test_makescaffold.dot longlines.dot")
+  run("#{$bin}test.x scaffold #{$testdata}/primary-contigs.fa #{$testdata}/libPE_shortlines.de #{$testdata}/libPE.astat false", :retval => 0)
+  run("diff longlines.dot gt_scaffolder_algorithms_test_makescaffold.dot", :retval => 0)
+  run("diff longlines.dot #{$testdata}gt_scaffolder_algorithms_test_makescaffold_expected.dot", :retval => 0)
+end
+
+Name "gt scaffolder scaffold: long contig headers"
+Keywords "scaffold DistEst astat"
+Test do
+  long_header = "contig-4616" + "L" * 1100
+  run("sed 's/^>contig-4616 />#{long_header} /' #{$testdata}/primary-contigs.fa > longheader.fa")
+  run("#{$bin}test.x scaffold longheader.fa #{$testdata}/libPE_longheader.de #{$testdata}/libPE_longheader.astat false", :retval => 0)
+  run("sed 's/L\\{1100\\}//' gt_scaffolder_algorithms_test_makescaffold.dot | diff - #{$testdata}gt_scaffolder_algorithms_test_makescaffold_expected.dot", :retval => 0)
+end
+
+Name "gt scaffolder parser: parse numbers like sscanf"
+Keywords "parser DistEst"
+Test do
+  run("#{$bin}test.x parser #{$testdata}/numbers.de", :retval => 0)
+  run("diff $(pwd)/gt_scaffolder_parser_test_read_distances.de #{$testdata}/numbers_expected.de", :retval => 0)
+  run("#{$bin}test.x scaffold #{$testdata}/primary-contigs.fa #{$testdata}/overflow.de #{$testdata}/libPE.astat false", :retval => 255)
+  grep(last_stderr, /Invalid record in dist file .*overflow.de/)
+end